@@ -15,6 +15,12 @@ class SerializableParam: Managed
 		return false;
 	}
 	
+	// bytes Write() puts on the wire, only used for metrics. override it if you want your params counted
+	int GetSerializedSize()
+	{
+		return 0;
+	}
+	
 	Param ToParam()
 	{
 		return null;
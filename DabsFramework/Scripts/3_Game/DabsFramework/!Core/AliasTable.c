@@ -0,0 +1,179 @@
+// Walker / Vose alias table, weighted random selection in O(1)
+// Build() is the only function that allocates, call it whenever the weights change
+/*
+	Example:
+
+	map<string, float> weights = new map<string, float>();
+	weights["common"] = 10.0;
+	weights["rare"] = 0.25;
+
+	AliasTable<string> table = new AliasTable<string>();
+	table.Build(weights);
+	Print(table.Sample());
+*/
+class AliasTable<Class T>: Managed
+{
+	static const T EMPTY;
+
+	protected ref array<T> m_Values = {};
+	protected ref array<float> m_Weights = {};
+	protected ref array<float> m_Probabilities = {};
+	protected ref array<int> m_Aliases = {};
+
+	// used for exclusive selection, m_CumulativeWeights[i] is the sum of all weights up to and including i
+	protected ref array<float> m_CumulativeWeights = {};
+	protected ref map<T, int> m_Indices = new map<T, int>();
+	protected float m_TotalWeight;
+
+	void Build(map<T, float> weights)
+	{
+		Clear();
+
+		foreach (T value, float weight: weights) {
+			// zero weighted entries can never be selected, no point in storing them
+			if (weight <= 0) {
+				continue;
+			}
+
+			m_TotalWeight += weight;
+			m_Indices[value] = m_Values.Insert(value);
+			m_Weights.Insert(weight);
+			m_CumulativeWeights.Insert(m_TotalWeight);
+		}
+
+		int count = m_Values.Count();
+		if (count == 0) {
+			return;
+		}
+
+		m_Probabilities.Resize(count);
+		m_Aliases.Resize(count);
+
+		// scale every weight so the average is exactly 1
+		array<float> scaled = {};
+		scaled.Resize(count);
+		array<int> small = {};
+		array<int> large = {};
+		for (int i = 0; i < count; i++) {
+			scaled[i] = m_Weights[i] * count / m_TotalWeight;
+			m_Aliases[i] = i;
+
+			if (scaled[i] < 1.0) {
+				small.Insert(i);
+			} else {
+				large.Insert(i);
+			}
+		}
+
+		// pair every under-full column with an over-full one
+		while (small.Count() > 0 && large.Count() > 0) {
+			int low = small[small.Count() - 1];
+			small.Remove(small.Count() - 1);
+			int high = large[large.Count() - 1];
+			large.Remove(large.Count() - 1);
+
+			m_Probabilities[low] = scaled[low];
+			m_Aliases[low] = high;
+
+			scaled[high] = (scaled[high] + scaled[low]) - 1.0;
+			if (scaled[high] < 1.0) {
+				small.Insert(high);
+			} else {
+				large.Insert(high);
+			}
+		}
+
+		// whatever is left over is full, any remainder is floating point error
+		foreach (int large_index: large) {
+			m_Probabilities[large_index] = 1.0;
+		}
+
+		foreach (int small_index: small) {
+			m_Probabilities[small_index] = 1.0;
+		}
+	}
+
+	// O(1), returns EMPTY when there is nothing to select
+	T Sample()
+	{
+		int count = m_Values.Count();
+		if (count == 0) {
+			return EMPTY;
+		}
+
+		int index = Math.RandomInt(0, count);
+		if (Math.RandomFloat01() < m_Probabilities[index]) {
+			return m_Values[index];
+		}
+
+		return m_Values[m_Aliases[index]];
+	}
+
+	// O(log n), selects any value other than 'exclude' with the remaining weights renormalized
+	// falls back to Sample() when 'exclude' is the only value or isnt in the table
+	T SampleExcluding(T exclude)
+	{
+		int count = m_Values.Count();
+		if (count < 2 || !m_Indices.Contains(exclude)) {
+			return Sample();
+		}
+
+		int excluded_index = m_Indices[exclude];
+		float excluded_weight = m_Weights[excluded_index];
+
+		// pick a point on the weight line with the excluded section cut out, then jump over it
+		float point = Math.RandomFloat01() * (m_TotalWeight - excluded_weight);
+		if (point >= m_CumulativeWeights[excluded_index] - excluded_weight) {
+			point += excluded_weight;
+		}
+
+		int low = 0;
+		int high = count - 1;
+		while (low < high) {
+			int middle = (low + high) / 2;
+			if (m_CumulativeWeights[middle] > point) {
+				high = middle;
+			} else {
+				low = middle + 1;
+			}
+		}
+
+		// only reachable through floating point error on the section boundary
+		if (low == excluded_index) {
+			low = Ternary<int>.If(low == 0, 1, low - 1);
+		}
+
+		return m_Values[low];
+	}
+
+	// chance of the value being selected by Sample(), 0..1
+	float GetProbability(T value)
+	{
+		if (!m_Indices.Contains(value) || m_TotalWeight <= 0) {
+			return 0;
+		}
+
+		return m_Weights[m_Indices[value]] / m_TotalWeight;
+	}
+
+	float GetTotalWeight()
+	{
+		return m_TotalWeight;
+	}
+
+	int Count()
+	{
+		return m_Values.Count();
+	}
+
+	void Clear()
+	{
+		m_Values.Clear();
+		m_Weights.Clear();
+		m_Probabilities.Clear();
+		m_Aliases.Clear();
+		m_CumulativeWeights.Clear();
+		m_Indices.Clear();
+		m_TotalWeight = 0;
+	}
+}
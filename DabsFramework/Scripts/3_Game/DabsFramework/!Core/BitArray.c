@@ -0,0 +1,106 @@
+// Growable set of bits, packed 32 to an int
+class BitArray: Managed
+{
+	static const int WORD_BITS = 32;
+	static const int WORD_SHIFT = 5;
+	static const int WORD_MASK = 31;
+
+	protected ref array<int> m_Words = {};
+
+	void Set(int index)
+	{
+		int word = index >> WORD_SHIFT;
+		while (m_Words.Count() <= word) {
+			m_Words.Insert(0);
+		}
+
+		m_Words[word] = m_Words[word] | (1 << (index & WORD_MASK));
+	}
+
+	void Unset(int index)
+	{
+		if (!Get(index)) {
+			return;
+		}
+
+		int word = index >> WORD_SHIFT;
+		m_Words[word] = m_Words[word] ^ (1 << (index & WORD_MASK));
+	}
+
+	bool Get(int index)
+	{
+		int word = index >> WORD_SHIFT;
+		if (word >= m_Words.Count()) {
+			return false;
+		}
+
+		return (m_Words[word] & (1 << (index & WORD_MASK))) != 0;
+	}
+
+	// true if any bit is set in both arrays
+	bool Intersects(BitArray other)
+	{
+		if (!other) {
+			return false;
+		}
+
+		int count = Math.Min(m_Words.Count(), other.GetWordCount());
+		for (int i = 0; i < count; i++) {
+			if ((m_Words[i] & other.GetWord(i)) != 0) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// returns the lowest bit set in both arrays, -1 if there is none
+	int FindFirstIntersection(BitArray other)
+	{
+		if (!other) {
+			return -1;
+		}
+
+		int count = Math.Min(m_Words.Count(), other.GetWordCount());
+		for (int i = 0; i < count; i++) {
+			int common = m_Words[i] & other.GetWord(i);
+			if (common == 0) {
+				continue;
+			}
+
+			for (int bit = 0; bit < WORD_BITS; bit++) {
+				if ((common & (1 << bit)) != 0) {
+					return (i << WORD_SHIFT) + bit;
+				}
+			}
+		}
+
+		return -1;
+	}
+
+	bool IsEmpty()
+	{
+		foreach (int word: m_Words) {
+			if (word != 0) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void Clear()
+	{
+		m_Words.Clear();
+	}
+
+	int GetWordCount()
+	{
+		return m_Words.Count();
+	}
+
+	int GetWord(int word)
+	{
+		return m_Words[word];
+	}
+}
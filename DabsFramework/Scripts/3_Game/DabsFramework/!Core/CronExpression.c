@@ -0,0 +1,241 @@
+// Standard 5 field cron expression, minute hour day-of-month month day-of-week
+//
+//	"0 * * * *"				every hour on the hour
+//	"0 21 * * *"			21:00 every day
+//	"*/15 8-20 * * 1-5"		every 15 minutes between 08:00 and 20:59, monday to friday
+//
+// Fields accept *, numbers, lists (1,2,3), ranges (1-5) and steps (*/15, 0-30/10).
+// Day of week runs 0-6 starting on sunday, 7 is also sunday.
+// Like cron, when both day fields are restricted a date matching either of them fires.
+class CronExpression: Managed
+{
+	static const int MINUTE = 0;
+	static const int HOUR = 1;
+	static const int DAY_OF_MONTH = 2;
+	static const int MONTH = 3;
+	static const int DAY_OF_WEEK = 4;
+	static const int FIELD_COUNT = 5;
+	
+	static const int FIELD_MIN[5] = { 0, 0, 1, 1, 0 };
+	static const int FIELD_MAX[5] = { 59, 23, 31, 12, 7 };
+	
+	// GetNext gives up after this many years without a match (i.e. 30th of february)
+	static const int MAX_SEARCH_YEARS = 5;
+	
+	protected string m_Expression;
+	protected ref array<ref BitArray> m_Fields = {};
+	protected bool m_DayOfMonthRestricted, m_DayOfWeekRestricted;
+	
+	// returns null when the expression is invalid
+	static CronExpression Parse(string expression)
+	{
+		CronExpression cron_expression = new CronExpression();
+		if (!cron_expression.SetExpression(expression)) {
+			return null;
+		}
+		
+		return cron_expression;
+	}
+	
+	// returns false when the expression is invalid, the previous one is kept
+	bool SetExpression(string expression)
+	{
+		array<string> fields = {};
+		expression.Trim().Split(" ", fields);
+		
+		// multiple spaces between fields
+		for (int i = fields.Count() - 1; i >= 0; i--) {
+			if (fields[i] == string.Empty) {
+				fields.RemoveOrdered(i);
+			}
+		}
+		
+		if (fields.Count() != FIELD_COUNT) {
+			return false;
+		}
+		
+		array<ref BitArray> parsed_fields = {};
+		for (int field = 0; field < FIELD_COUNT; field++) {
+			BitArray values = ParseField(fields[field], FIELD_MIN[field], FIELD_MAX[field]);
+			if (!values) {
+				return false;
+			}
+			
+			parsed_fields.Insert(values);
+		}
+		
+		// sunday can be written as 0 or 7
+		if (parsed_fields[DAY_OF_WEEK].Get(7)) {
+			parsed_fields[DAY_OF_WEEK].Set(0);
+		}
+		
+		m_Expression = expression;
+		m_Fields = parsed_fields;
+		m_DayOfMonthRestricted = fields[DAY_OF_MONTH][0] != "*";
+		m_DayOfWeekRestricted = fields[DAY_OF_WEEK][0] != "*";
+		return true;
+	}
+	
+	// first matching minute strictly after 'after', DateTime.EPOCH if there is none within MAX_SEARCH_YEARS
+	DateTime GetNext(DateTime after)
+	{
+		if (m_Fields.Count() != FIELD_COUNT) {
+			return DateTime.EPOCH;
+		}
+		
+		int year, month, day, hour, minute, second;
+		DateTime.ToDate(after - (after % TimeSpan.MINUTE) + TimeSpan.MINUTE, year, month, day, hour, minute, second);
+		
+		int last_year = year + MAX_SEARCH_YEARS;
+		while (year <= last_year) {
+			if (!m_Fields[MONTH].Get(month)) {
+				month++;
+				day = 1;
+				hour = 0;
+				minute = 0;
+			} else if (!MatchesDay(year, month, day)) {
+				day++;
+				hour = 0;
+				minute = 0;
+			} else if (!m_Fields[HOUR].Get(hour)) {
+				hour++;
+				minute = 0;
+			} else if (!m_Fields[MINUTE].Get(minute)) {
+				minute++;
+			} else {
+				return DateTime.Create(year, month, day, hour, minute, 0);
+			}
+			
+			Normalize(year, month, day, hour, minute);
+		}
+		
+		return DateTime.EPOCH;
+	}
+	
+	bool Matches(DateTime date_time)
+	{
+		if (m_Fields.Count() != FIELD_COUNT) {
+			return false;
+		}
+		
+		int year, month, day, hour, minute, second;
+		DateTime.ToDate(date_time, year, month, day, hour, minute, second);
+		return m_Fields[MONTH].Get(month) && MatchesDay(year, month, day) && m_Fields[HOUR].Get(hour) && m_Fields[MINUTE].Get(minute);
+	}
+	
+	string GetExpression()
+	{
+		return m_Expression;
+	}
+	
+	protected bool MatchesDay(int year, int month, int day)
+	{
+		bool day_of_month = m_Fields[DAY_OF_MONTH].Get(day);
+		bool day_of_week = m_Fields[DAY_OF_WEEK].Get(GetDayOfWeek(year, month, day));
+		if (m_DayOfMonthRestricted && m_DayOfWeekRestricted) {
+			return day_of_month || day_of_week;
+		}
+		
+		return day_of_month && day_of_week;
+	}
+	
+	// carries overflowing fields into the next one up
+	protected static void Normalize(inout int year, inout int month, inout int day, inout int hour, inout int minute)
+	{
+		if (minute > 59) {
+			minute = 0;
+			hour++;
+		}
+		
+		if (hour > 23) {
+			hour = 0;
+			day++;
+		}
+		
+		if (month <= 12 && day > DateTime.DaysInMonth(month, DateTime.IsLeapYear(year))) {
+			day = 1;
+			month++;
+		}
+		
+		if (month > 12) {
+			month = 1;
+			year++;
+		}
+	}
+	
+	// 0 is sunday, https://en.wikipedia.org/wiki/Determination_of_the_day_of_the_week#Sakamoto's_methods
+	static int GetDayOfWeek(int year, int month, int day)
+	{
+		static const int MONTH_OFFSETS[12] = { 0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4 };
+		if (month < 3) {
+			year -= 1;
+		}
+		
+		return (year + year / 4 - year / 100 + year / 400 + MONTH_OFFSETS[month - 1] + day) % 7;
+	}
+	
+	protected static BitArray ParseField(string field, int min, int max)
+	{
+		BitArray values = new BitArray();
+		array<string> items = {};
+		field.Split(",", items);
+		foreach (string item: items) {
+			int step = 1;
+			int step_index = item.IndexOf("/");
+			if (step_index != -1) {
+				if (!ParseNumber(item.Substring(step_index + 1, item.Length() - step_index - 1), step) || step <= 0) {
+					return null;
+				}
+				
+				item = item.Substring(0, step_index);
+			}
+			
+			int first = min;
+			int last = max;
+			if (item != "*") {
+				int range_index = item.IndexOf("-");
+				if (range_index != -1) {
+					if (!ParseNumber(item.Substring(0, range_index), first) || !ParseNumber(item.Substring(range_index + 1, item.Length() - range_index - 1), last)) {
+						return null;
+					}
+				} else {
+					if (!ParseNumber(item, first)) {
+						return null;
+					}
+					
+					// "5/10" means 5 to max in steps of 10
+					last = first;
+					if (step_index != -1) {
+						last = max;
+					}
+				}
+			}
+			
+			if (first < min || last > max || first > last) {
+				return null;
+			}
+			
+			for (int value = first; value <= last; value += step) {
+				values.Set(value);
+			}
+		}
+		
+		return values;
+	}
+	
+	protected static bool ParseNumber(string text, out int number)
+	{
+		if (text == string.Empty) {
+			return false;
+		}
+		
+		for (int i = 0; i < text.Length(); i++) {
+			if ("0123456789".IndexOf(text[i]) == -1) {
+				return false;
+			}
+		}
+		
+		number = text.ToInt();
+		return true;
+	}
+}
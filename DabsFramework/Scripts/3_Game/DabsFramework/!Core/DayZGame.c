@@ -108,6 +108,15 @@ modded class DayZGame
 	}
 #endif
 	
+	override void OnUpdate(bool doSim, float timeslice)
+	{
+		super.OnUpdate(doSim, timeslice);
+		
+		if (m_EventManager) {
+			m_EventManager.OnUpdate(timeslice);
+		}
+	}
+	
 	// this is the init of event manager for clients
 	override void OnEvent(EventType eventTypeId, Param params)
 	{
@@ -199,6 +208,12 @@ modded class DayZGame
 		return m_EventManager;
 	}
 	
+	// only meant for swapping in a simulated manager, see EventSimulation
+	void SetEventManager(EventManager event_manager)
+	{
+		m_EventManager = event_manager;
+	}
+	
 	SuppressedObjectManager GetSuppressedObjectManager()
 	{
 		return m_SuppressedObjectManager;
@@ -0,0 +1,199 @@
+// Double ended queue on a power of two ring buffer, O(1) push / pop at both ends and index access
+// bounded: never grows past its capacity, pushing into a full deque drops the entry at the other end
+class Deque<Class T>: Managed
+{
+	static const T EMPTY;
+	static const int MIN_CAPACITY = 8;
+
+	protected ref array<ref T> m_Buffer = {};
+	protected int m_Mask;
+	protected int m_Head;
+	protected int m_Count;
+
+	// 0 when unbounded
+	protected int m_MaxCount;
+
+	void Deque(int capacity = 0, bool bounded = false)
+	{
+		if (bounded && capacity > 0) {
+			m_MaxCount = capacity;
+		}
+
+		int size = MIN_CAPACITY;
+		while (size < capacity) {
+			size = size << 1;
+		}
+
+		m_Buffer.Resize(size);
+		m_Mask = size - 1;
+	}
+
+	void PushBack(T value)
+	{
+		if (IsFull()) {
+			// drop the entry at the front
+			PopFront();
+		}
+
+		Reserve(m_Count + 1);
+		m_Buffer[(m_Head + m_Count) & m_Mask] = value;
+		m_Count++;
+	}
+
+	void PushFront(T value)
+	{
+		if (IsFull()) {
+			// drop the entry at the back
+			PopBack();
+		}
+
+		Reserve(m_Count + 1);
+		m_Head = (m_Head - 1) & m_Mask;
+		m_Buffer[m_Head] = value;
+		m_Count++;
+	}
+
+	T PopFront()
+	{
+		if (m_Count == 0) {
+			return EMPTY;
+		}
+
+		T value = m_Buffer[m_Head];
+		m_Buffer[m_Head] = EMPTY;
+		m_Head = (m_Head + 1) & m_Mask;
+		m_Count--;
+		return value;
+	}
+
+	T PopBack()
+	{
+		if (m_Count == 0) {
+			return EMPTY;
+		}
+
+		int index = (m_Head + m_Count - 1) & m_Mask;
+		T value = m_Buffer[index];
+		m_Buffer[index] = EMPTY;
+		m_Count--;
+		return value;
+	}
+
+	T PeekFront()
+	{
+		if (m_Count == 0) {
+			return EMPTY;
+		}
+
+		return m_Buffer[m_Head];
+	}
+
+	T PeekBack()
+	{
+		if (m_Count == 0) {
+			return EMPTY;
+		}
+
+		return m_Buffer[(m_Head + m_Count - 1) & m_Mask];
+	}
+
+	// n counts from the front
+	T Get(int n)
+	{
+		if (n < 0 || n >= m_Count) {
+			return EMPTY;
+		}
+
+		return m_Buffer[(m_Head + n) & m_Mask];
+	}
+
+	void Set(int n, T value)
+	{
+		if (n < 0 || n >= m_Count) {
+			return;
+		}
+
+		m_Buffer[(m_Head + n) & m_Mask] = value;
+	}
+
+	// makes room for count entries without growing again, ignored when bounded
+	void Reserve(int count)
+	{
+		if (count <= m_Buffer.Count() || m_MaxCount > 0) {
+			return;
+		}
+
+		int size = m_Buffer.Count();
+		while (size < count) {
+			size = size << 1;
+		}
+
+		// unwrap into the new buffer, front first
+		array<ref T> buffer = {};
+		buffer.Resize(size);
+		for (int i = 0; i < m_Count; i++) {
+			buffer[i] = m_Buffer[(m_Head + i) & m_Mask];
+		}
+
+		m_Buffer = buffer;
+		m_Mask = size - 1;
+		m_Head = 0;
+	}
+
+	array<T> ToArray()
+	{
+		array<T> values = {};
+		values.Reserve(m_Count);
+		for (int i = 0; i < m_Count; i++) {
+			values.Insert(m_Buffer[(m_Head + i) & m_Mask]);
+		}
+
+		return values;
+	}
+
+	int Count()
+	{
+		return m_Count;
+	}
+
+	bool IsEmpty()
+	{
+		return m_Count == 0;
+	}
+
+	bool IsFull()
+	{
+		return m_MaxCount > 0 && m_Count >= m_MaxCount;
+	}
+
+	bool IsBounded()
+	{
+		return m_MaxCount > 0;
+	}
+
+	// max entries when bounded, otherwise the size of the current buffer
+	int GetCapacity()
+	{
+		if (m_MaxCount > 0) {
+			return m_MaxCount;
+		}
+
+		return m_Buffer.Count();
+	}
+
+	// keeps the buffer, only releases the entries
+	void Clear()
+	{
+		for (int i = 0; i < m_Count; i++) {
+			m_Buffer[(m_Head + i) & m_Mask] = EMPTY;
+		}
+
+		m_Head = 0;
+		m_Count = 0;
+	}
+
+	typename GetType()
+	{
+		return T;
+	}
+}
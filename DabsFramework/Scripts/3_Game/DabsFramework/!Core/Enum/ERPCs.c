@@ -2,4 +2,7 @@ enum ERPCsDabsFramework
 {
 	EVENT_UPDATE = 3059462,
 	EVENT_FUNCTION = 3059464,
+	EVENT_REGISTRY = 3059466,
+	EVENT_SNAPSHOT = 3059468,
+	EVENT_SNAPSHOT_ACK = 3059470,
 };
\ No newline at end of file
@@ -0,0 +1,12 @@
+// Why EventManager::StartEvent refused to start an event
+enum EventRejectReason
+{
+	MAX_EVENTS			= 0, // m_MaxEventCount events already running
+	COOLDOWN			= 1,
+	SPAWN_FAILED		= 2,
+	MAX_TYPE_COUNT		= 3, // EventBase::MaxEventCount of this type already running
+	CONFLICT			= 4, // EventBase::GetDisallowedEvents
+	ACTIVATE_CONDITION	= 5, // EventBase::EventActivateCondition
+	
+	COUNT
+};
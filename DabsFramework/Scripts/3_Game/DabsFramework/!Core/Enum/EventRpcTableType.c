@@ -0,0 +1,8 @@
+// Tables of the EventRpcRegistry, every entry gets a small integer id
+enum EventRpcTableType
+{
+	EVENT_TYPE		= 0,
+	PARAM_TYPE		= 1,
+	FUNCTION		= 2,
+	COUNT
+};
\ No newline at end of file
@@ -0,0 +1,7 @@
+// Work items the EventManager scheduler runs on behalf of an EventBase
+enum EventTaskType
+{
+	CLIENT_UPDATE		= 0,
+	SERVER_UPDATE		= 1,
+	PHASE_END			= 2
+};
\ No newline at end of file
@@ -0,0 +1,89 @@
+// Fixed bucket histogram, bucket i counts values below bounds[i], the last bucket everything above the final bound
+class Histogram: Managed
+{
+	protected ref array<float> m_Bounds = {};
+	protected ref array<int> m_Buckets = {};
+	
+	protected int m_Count;
+	protected float m_Sum, m_Min, m_Max;
+	
+	// bounds must be ascending
+	void Histogram(array<float> bounds)
+	{
+		m_Bounds.Copy(bounds);
+		for (int i = 0; i <= m_Bounds.Count(); i++) {
+			m_Buckets.Insert(0);
+		}
+	}
+	
+	void Add(float value)
+	{
+		if (m_Count == 0 || value < m_Min) {
+			m_Min = value;
+		}
+		
+		if (m_Count == 0 || value > m_Max) {
+			m_Max = value;
+		}
+		
+		m_Count++;
+		m_Sum += value;
+		
+		int bucket;
+		while (bucket < m_Bounds.Count() && value >= m_Bounds[bucket]) {
+			bucket++;
+		}
+		
+		m_Buckets[bucket] = m_Buckets[bucket] + 1;
+	}
+	
+	int GetCount()
+	{
+		return m_Count;
+	}
+	
+	float GetSum()
+	{
+		return m_Sum;
+	}
+	
+	float GetMean()
+	{
+		if (m_Count == 0) {
+			return 0;
+		}
+		
+		return m_Sum / m_Count;
+	}
+	
+	float GetMin()
+	{
+		return m_Min;
+	}
+	
+	float GetMax()
+	{
+		return m_Max;
+	}
+	
+	array<float> GetBounds()
+	{
+		return m_Bounds;
+	}
+	
+	array<int> GetBuckets()
+	{
+		return m_Buckets;
+	}
+	
+	void Clear()
+	{
+		m_Count = 0;
+		m_Sum = 0;
+		m_Min = 0;
+		m_Max = 0;
+		for (int i = 0; i < m_Buckets.Count(); i++) {
+			m_Buckets[i] = 0;
+		}
+	}
+}
@@ -0,0 +1,206 @@
+// Bounded cache that drops the least recently used entries first
+// every entry counts against the capacity with its size (1 unless Set is given one), so the cache can be bounded by count or by a cost of your choosing
+class LRUCache<Class TKey, Class TValue>: Managed
+{
+	static const TValue EMPTY;
+
+	protected int m_Capacity;
+	protected int m_Size;
+
+	protected ref map<TKey, ref LRUCacheEntry<TKey, TValue>> m_Entries = new map<TKey, ref LRUCacheEntry<TKey, TValue>>();
+
+	// most recently used first, the map holds the entries
+	protected LRUCacheEntry<TKey, TValue> m_Head;
+	protected LRUCacheEntry<TKey, TValue> m_Tail;
+
+	protected int m_Hits;
+	protected int m_Misses;
+	protected int m_Evictions;
+
+	// 0: TKey key
+	// 1: TValue value
+	ref ScriptInvoker Event_OnEvicted = new ScriptInvoker();
+	ref ScriptInvoker Event_OnInvalidated = new ScriptInvoker();
+
+	void LRUCache(int capacity = 128)
+	{
+		m_Capacity = capacity;
+	}
+
+	// counts a hit or a miss, a hit becomes the most recently used entry
+	bool Find(TKey key, out TValue value)
+	{
+		LRUCacheEntry<TKey, TValue> entry = m_Entries[key];
+		if (!entry) {
+			m_Misses++;
+			return false;
+		}
+
+		m_Hits++;
+		Unlink(entry);
+		LinkFront(entry);
+		value = entry.Value;
+		return true;
+	}
+
+	// EMPTY when key isnt cached
+	TValue Get(TKey key)
+	{
+		TValue value;
+		if (!Find(key, value)) {
+			return EMPTY;
+		}
+
+		return value;
+	}
+
+	// doesnt count or touch anything
+	bool Contains(TKey key)
+	{
+		return m_Entries.Contains(key);
+	}
+
+	void Set(TKey key, TValue value, int size = 1)
+	{
+		LRUCacheEntry<TKey, TValue> entry = m_Entries[key];
+		if (entry) {
+			m_Size -= entry.Size;
+			Unlink(entry);
+		} else {
+			entry = new LRUCacheEntry<TKey, TValue>();
+			entry.Key = key;
+			m_Entries.Insert(key, entry);
+		}
+
+		entry.Value = value;
+		entry.Size = size;
+		m_Size += size;
+		LinkFront(entry);
+
+		// the new entry stays, even when it doesnt fit on its own
+		while (m_Size > m_Capacity && m_Tail && m_Tail != entry) {
+			LRUCacheEntry<TKey, TValue> evicted = m_Tail;
+			m_Evictions++;
+			Event_OnEvicted.Invoke(evicted.Key, evicted.Value);
+			RemoveEntry(evicted);
+		}
+	}
+
+	// drops key, for when whatever it was computed from changed
+	bool Invalidate(TKey key)
+	{
+		LRUCacheEntry<TKey, TValue> entry = m_Entries[key];
+		if (!entry) {
+			return false;
+		}
+
+		Event_OnInvalidated.Invoke(entry.Key, entry.Value);
+		RemoveEntry(entry);
+		return true;
+	}
+
+	void InvalidateAll()
+	{
+		while (m_Head) {
+			Invalidate(m_Head.Key);
+		}
+	}
+
+	void SetCapacity(int capacity)
+	{
+		m_Capacity = capacity;
+		while (m_Size > m_Capacity && m_Tail) {
+			m_Evictions++;
+			Event_OnEvicted.Invoke(m_Tail.Key, m_Tail.Value);
+			RemoveEntry(m_Tail);
+		}
+	}
+
+	int GetCapacity()
+	{
+		return m_Capacity;
+	}
+
+	// sum of the entry sizes
+	int GetSize()
+	{
+		return m_Size;
+	}
+
+	int Count()
+	{
+		return m_Entries.Count();
+	}
+
+	int GetHits()
+	{
+		return m_Hits;
+	}
+
+	int GetMisses()
+	{
+		return m_Misses;
+	}
+
+	int GetEvictions()
+	{
+		return m_Evictions;
+	}
+
+	void ResetStats()
+	{
+		m_Hits = 0;
+		m_Misses = 0;
+		m_Evictions = 0;
+	}
+
+	protected void RemoveEntry(LRUCacheEntry<TKey, TValue> entry)
+	{
+		Unlink(entry);
+		m_Size -= entry.Size;
+		m_Entries.Remove(entry.Key);
+	}
+
+	protected void LinkFront(LRUCacheEntry<TKey, TValue> entry)
+	{
+		entry.Previous = null;
+		entry.Next = m_Head;
+		if (m_Head) {
+			m_Head.Previous = entry;
+		}
+
+		m_Head = entry;
+		if (!m_Tail) {
+			m_Tail = entry;
+		}
+	}
+
+	protected void Unlink(LRUCacheEntry<TKey, TValue> entry)
+	{
+		if (entry.Previous) {
+			entry.Previous.Next = entry.Next;
+		} else if (m_Head == entry) {
+			m_Head = entry.Next;
+		}
+
+		if (entry.Next) {
+			entry.Next.Previous = entry.Previous;
+		} else if (m_Tail == entry) {
+			m_Tail = entry.Previous;
+		}
+
+		entry.Previous = null;
+		entry.Next = null;
+	}
+}
+
+class LRUCacheEntry<Class TKey, Class TValue>: Managed
+{
+	TKey Key;
+	ref TValue Value;
+	int Size;
+
+	// links are weak, LRUCache::m_Entries owns the entries
+	LRUCacheEntry<TKey, TValue> Previous;
+	LRUCacheEntry<TKey, TValue> Next;
+}
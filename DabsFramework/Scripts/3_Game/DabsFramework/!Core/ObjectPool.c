@@ -0,0 +1,168 @@
+// Hands out reused instances of T instead of allocating a new one every time
+// override Create when T has no default constructor, and OnRelease to clear anything the next user shouldnt see
+// released objects must not be used again by whoever released them
+class ObjectPool<Class T>: Managed
+{
+	protected ref array<ref T> m_Free = {};
+
+	// same objects as m_Free, catches double releases
+	protected ref map<T, bool> m_FreeItems = new map<T, bool>();
+
+	// released objects past this are dropped, 0 keeps all of them
+	protected int m_MaxFree;
+
+	protected int m_Created;
+	protected int m_InUse;
+	protected int m_HighWaterMark;
+
+	// see SetTrim
+	protected int m_TrimKeepFree;
+	protected int m_TrimPerFrame;
+
+	void ObjectPool(int max_free = 0)
+	{
+		m_MaxFree = max_free;
+	}
+
+	void ~ObjectPool()
+	{
+		if (m_TrimPerFrame > 0 && GetGame()) {
+			GetGame().GetUpdateQueue(CALL_CATEGORY_SYSTEM).Remove(OnTrimUpdate);
+		}
+	}
+
+	T Acquire()
+	{
+		T item;
+		int count = m_Free.Count();
+		if (count > 0) {
+			item = m_Free[count - 1];
+			m_Free.Remove(count - 1);
+			m_FreeItems.Remove(item);
+		} else {
+			item = Create();
+			m_Created++;
+		}
+
+		m_InUse++;
+		m_HighWaterMark = Math.Max(m_HighWaterMark, m_InUse);
+		OnAcquire(item);
+		return item;
+	}
+
+	void Release(T item)
+	{
+		if (!item) {
+			return;
+		}
+
+		if (m_FreeItems.Contains(item)) {
+			Error(string.Format("%1 released twice to %2", item, this));
+			return;
+		}
+
+		// only objects still out can come back, anything else was never handed out by this pool
+		if (m_InUse <= 0) {
+			Error(string.Format("%1 was not acquired from %2", item, this));
+			return;
+		}
+
+		OnRelease(item);
+		m_InUse--;
+		if (m_MaxFree > 0 && m_Free.Count() >= m_MaxFree) {
+			return;
+		}
+
+		m_Free.Insert(item);
+		m_FreeItems.Insert(item, true);
+	}
+
+	// drops free objects until keep_free are left
+	void Trim(int keep_free = 0)
+	{
+		for (int i = m_Free.Count() - 1; i >= keep_free; i--) {
+			m_FreeItems.Remove(m_Free[i]);
+			m_Free.Remove(i);
+		}
+	}
+
+	// drops up to per_frame free objects every frame until keep_free are left, per_frame 0 turns it off
+	// spreads the cost of letting go of a burst over several frames
+	void SetTrim(int keep_free, int per_frame = 1)
+	{
+		if (!GetGame()) {
+			return;
+		}
+
+		ScriptInvoker update_queue = GetGame().GetUpdateQueue(CALL_CATEGORY_SYSTEM);
+		if (m_TrimPerFrame > 0) {
+			update_queue.Remove(OnTrimUpdate);
+		}
+
+		m_TrimKeepFree = keep_free;
+		m_TrimPerFrame = per_frame;
+		if (m_TrimPerFrame > 0) {
+			update_queue.Insert(OnTrimUpdate);
+		}
+	}
+
+	protected void OnTrimUpdate()
+	{
+		int keep_free = Math.Max(m_TrimKeepFree, m_Free.Count() - m_TrimPerFrame);
+		Trim(keep_free);
+	}
+
+	// objects the pool had to allocate, the rest of the acquires were reused
+	int GetCreatedCount()
+	{
+		return m_Created;
+	}
+
+	int GetInUseCount()
+	{
+		return m_InUse;
+	}
+
+	int GetFreeCount()
+	{
+		return m_Free.Count();
+	}
+
+	// most objects that were in use at the same time
+	int GetHighWaterMark()
+	{
+		return m_HighWaterMark;
+	}
+
+	void ResetHighWaterMark()
+	{
+		m_HighWaterMark = m_InUse;
+	}
+
+	protected T Create()
+	{
+		T item;
+		Class.CastTo(item, TemplateType<T>.GetType().Spawn());
+		return item;
+	}
+
+	protected void OnAcquire(T item)
+	{
+	}
+
+	// the reset hook, called before item goes back into the pool
+	protected void OnRelease(T item)
+	{
+	}
+}
+
+// Param1 has no default constructor
+class Param1Pool<Class T>: ObjectPool<Param1<T>>
+{
+	static const T EMPTY;
+
+	override protected Param1<T> Create()
+	{
+		return new Param1<T>(EMPTY);
+	}
+}
@@ -1,48 +1,74 @@
+// Array backed binary heap, the element with the lowest priority value is dequeued first
+// equal priorities dequeue in the order they were enqueued (see Invert)
+// over capacity the lowest priority element is evicted, the oldest one when several share it
+// elements are unique, GetPriority / UpdatePriority / Remove find them through an index map
 class PriorityQueue<Class TElement, Class TPriority>
 {
 	static const TElement ELEMENT_DEFAULT;
 	static const TPriority PRIORITY_DEFAULT;
 
 	protected int m_Capacity;
-	protected ref array<ref Managed> m_StrongRefElements = {};
-	protected ref array<ref Param2<TElement, TPriority>> m_Elements = {};
+
+	// min-max heap: even levels are ordered like a min heap, odd levels like a max heap
+	// gives O(1) access to the lowest priority element, so capacity eviction is O(log n) as well
+	// the catch: when the lowest priority is shared, it evicts the newest of them (often the element just enqueued)
+	// instead of the oldest, so a full queue of equal priorities doesnt behave like a drop oldest buffer anymore
+	protected bool m_MinMaxHeap;
+
+	// heap, all three arrays share the same index
+	protected ref array<ref TElement> m_Elements = {};
+	protected ref array<TPriority> m_Priorities = {};
+	protected ref array<int> m_Sequences = {};
+
+	protected ref map<TElement, int> m_Indices = new map<TElement, int>();
+
+	// tie breaker between equal priorities, Invert flips the step
+	protected int m_NextSequence;
+	protected int m_SequenceStep = 1;
 
 	ref ScriptInvoker Event_OnEnqueue = new ScriptInvoker();
 	ref ScriptInvoker Event_OnDequeue = new ScriptInvoker();
 
-	void PriorityQueue(int capacity = 0)
+	// min_max_heap is only worth it with a capacity, without one the lowest priority element is never looked up
+	void PriorityQueue(int capacity = 0, bool min_max_heap = false)
 	{
 		m_Capacity = capacity;
+		m_MinMaxHeap = min_max_heap;
 
 		if (capacity > 0) {
 			// resize the queue arrays internally, optimization
-			m_StrongRefElements.Reserve(capacity);
-			m_Elements.Reserve(capacity);
+			m_Elements.Reserve(capacity + 1);
+			m_Priorities.Reserve(capacity + 1);
+			m_Sequences.Reserve(capacity + 1);
 		}
 	}
 
 	// adds the specified element with associated priority
+	// an element that is already queued only gets its priority updated, it is never queued twice
 	void Enqueue(TElement item, TPriority priority)
 	{
-		if (TemplateType<TElement>.GetType().IsInherited(Managed)) {
-			// insert anonymously, elsewise compile time error
-			GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY).Call(m_StrongRefElements.Insert, item);
+		if (m_Indices.Contains(item)) {
+			UpdatePriority(item, priority);
+			return;
 		}
 
-		m_Elements.Insert(new Param2<TElement, TPriority>(item, priority));
+		int index = m_Elements.Insert(item);
+		m_Priorities.Insert(priority);
+		m_Sequences.Insert(m_NextSequence);
+		m_NextSequence += m_SequenceStep;
+		m_Indices.Set(item, index);
+		SiftUp(index);
+
 		Event_OnEnqueue.Invoke(item, priority);
 
 		// check if the queue exceeds the capacity, and if so, remove the lowest priority element
 		if (m_Capacity > 0 && m_Elements.Count() > m_Capacity) {
-			int index = GetLowestPriorityIndex();
+			index = GetLowestPriorityIndex();
 			if (index != -1) {
-				Param2<TElement, TPriority> lowestPriorityItem = m_Elements[index];
-				m_Elements.Remove(index);
-
-				if (TemplateType<TElement>.GetType().IsInherited(Managed)) {
-					GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY).Call(m_StrongRefElements.RemoveItem, lowestPriorityItem.param1);
-					Event_OnDequeue.Invoke(lowestPriorityItem.param1, lowestPriorityItem.param2);
-				}
+				TElement lowest_priority_item = m_Elements[index];
+				TPriority lowest_priority = m_Priorities[index];
+				RemoveAt(index);
+				Event_OnDequeue.Invoke(lowest_priority_item, lowest_priority);
 			}
 		}
 	}
@@ -66,21 +92,17 @@ class PriorityQueue<Class TElement, Class TPriority>
 	// removes and returns the minimal element from the queue; the element with the highest priority
 	TElement Dequeue()
 	{
-		int index = GetHighestPriorityIndex();
-		if (index == -1) {
+		if (Count() == 0) {
 			return ELEMENT_DEFAULT;
 		}
 
-		Param2<TElement, TPriority> highestPriorityItem = m_Elements[index];
-		m_Elements.Remove(index);
-
-		if (TemplateType<TElement>.GetType().IsInherited(Managed)) {
-			GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY).Call(m_StrongRefElements.RemoveItem, highestPriorityItem.param1);
-		}
+		TElement highest_priority_item = m_Elements[0];
+		TPriority highest_priority = m_Priorities[0];
+		RemoveAt(0);
 
-		Event_OnDequeue.Invoke(highestPriorityItem.param1, highestPriorityItem.param2);
+		Event_OnDequeue.Invoke(highest_priority_item, highest_priority);
 
-		return highestPriorityItem.param1;
+		return highest_priority_item;
 	}
 
 	// adds the specified element with associated priority to the queue, and immediately removes the minimal element, returning the result
@@ -93,33 +115,71 @@ class PriorityQueue<Class TElement, Class TPriority>
 	// returns the minimal element from the queue without removing it
 	TElement Peak()
 	{
-		int index = GetHighestPriorityIndex();
-		if (index == -1) {
+		if (Count() == 0) {
 			return ELEMENT_DEFAULT;
 		}
 
-		Param2<TElement, TPriority> item = m_Elements[index];
-		return item.param1;
+		return m_Elements[0];
 	}
-	
-	// returns priority of current element, slow
+
+	// returns priority of item, PRIORITY_DEFAULT when it isnt queued
 	TPriority GetPriority(TElement item)
 	{
-		for (int i = 0; i < m_Elements.Count(); i++) {
-			if (m_Elements[i].param1 == item) {
-				return m_Elements[i].param2;
-			}
+		int index;
+		if (!m_Indices.Find(item, index)) {
+			return PRIORITY_DEFAULT;
 		}
-		
-		return PRIORITY_DEFAULT;
+
+		return m_Priorities[index];
 	}
-	
+
+	// moves item to its new place in the queue, returns false when it isnt queued
+	bool UpdatePriority(TElement item, TPriority priority)
+	{
+		int index;
+		if (!m_Indices.Find(item, index)) {
+			return false;
+		}
+
+		m_Priorities[index] = priority;
+		SiftUp(index);
+		SiftDown(index);
+		return true;
+	}
+
+	// removes item without invoking Event_OnDequeue, returns false when it isnt queued
+	bool Remove(TElement item)
+	{
+		int index;
+		if (!m_Indices.Find(item, index)) {
+			return false;
+		}
+
+		RemoveAt(index);
+		return true;
+	}
+
+	bool Contains(TElement item)
+	{
+		return m_Indices.Contains(item);
+	}
+
+	// reverses the order equal priorities are dequeued in
 	void Invert()
 	{
-		m_Elements.Invert();
-		m_StrongRefElements.Invert();
+		m_SequenceStep = -m_SequenceStep;
+		for (int i = 0; i < m_Sequences.Count(); i++) {
+			m_Sequences[i] = -m_Sequences[i];
+		}
+
+		m_NextSequence = -m_NextSequence;
+
+		// rebuild the heap bottom up
+		for (int j = Count() / 2 - 1; j >= 0; j--) {
+			SiftDown(j);
+		}
 	}
-	
+
 	// returns max capacity of the queue
 	int GetCapacity()
 	{
@@ -135,41 +195,202 @@ class PriorityQueue<Class TElement, Class TPriority>
 	// destroys all elements
 	void Clear()
 	{
-		m_StrongRefElements.Clear();
 		m_Elements.Clear();
+		m_Priorities.Clear();
+		m_Sequences.Clear();
+		m_Indices.Clear();
 	}
 
 	// highest priority is a low value (1)
-	protected int GetHighestPriorityIndex()
+	protected bool IsHigherPriority(int a, int b)
 	{
-		if (Count() == 0) {
-			return -1;
+		if (m_Priorities[a] == m_Priorities[b]) {
+			return m_Sequences[a] < m_Sequences[b];
 		}
 
-		int highestIndex;
-		for (int i = 1; i < m_Elements.Count(); i++) {
-			if (m_Elements[i].param2 < m_Elements[highestIndex].param2) {
-				highestIndex = i;
-			}
+		return m_Priorities[a] < m_Priorities[b];
+	}
+
+	protected void Swap(int a, int b)
+	{
+		m_Elements.SwapItems(a, b);
+		m_Priorities.SwapItems(a, b);
+		m_Sequences.SwapItems(a, b);
+		m_Indices.Set(m_Elements[a], a);
+		m_Indices.Set(m_Elements[b], b);
+	}
+
+	protected void RemoveAt(int index)
+	{
+		int last = Count() - 1;
+		if (index != last) {
+			Swap(index, last);
 		}
 
-		return highestIndex;
+		m_Indices.Remove(m_Elements[last]);
+		m_Elements.Remove(last);
+		m_Priorities.Remove(last);
+		m_Sequences.Remove(last);
+
+		if (index < last) {
+			// whatever ends up at index after climbing still has to fit its children
+			SiftUp(index);
+			SiftDown(index);
+		}
 	}
 
 	// lowest priority is a high value (100)
 	protected int GetLowestPriorityIndex()
 	{
-		if (Count() == 0) {
-			return -1;
+		int count = Count();
+		if (count <= 1) {
+			return count - 1;
+		}
+
+		if (m_MinMaxHeap) {
+			// the root of the max levels is one of the two children of the root
+			if (count == 2 || IsHigherPriority(2, 1)) {
+				return 1;
+			}
+
+			return 2;
+		}
+
+		// full scan, the lowest priority is always on a leaf but the oldest of a tie can be any parent above it
+		int lowest_index;
+		for (int i = 1; i < count; i++) {
+			if (IsEvictedBefore(i, lowest_index)) {
+				lowest_index = i;
+			}
 		}
 
-		int lowestIndex;
-		for (int i = 1; i < m_Elements.Count(); i++) {
-			if (m_Elements[i].param2 > m_Elements[lowestIndex].param2) {
-				lowestIndex = i;
+		return lowest_index;
+	}
+
+	// eviction order, lowest priority first and the oldest of equal priorities first
+	protected bool IsEvictedBefore(int a, int b)
+	{
+		if (m_Priorities[a] == m_Priorities[b]) {
+			// step keeps this in enqueue order after Invert negated the sequences
+			return m_Sequences[a] * m_SequenceStep < m_Sequences[b] * m_SequenceStep;
+		}
+
+		return m_Priorities[a] > m_Priorities[b];
+	}
+
+	protected void SiftUp(int index)
+	{
+		if (!m_MinMaxHeap) {
+			while (index > 0) {
+				int heap_parent = (index - 1) / 2;
+				if (!IsHigherPriority(index, heap_parent)) {
+					return;
+				}
+
+				Swap(index, heap_parent);
+				index = heap_parent;
+			}
+
+			return;
+		}
+
+		if (index == 0) {
+			return;
+		}
+
+		// an element that belongs on the other kind of level crosses over once, then only climbs its own levels
+		int parent = (index - 1) / 2;
+		bool min_level = IsMinLevel(index);
+		if (min_level == IsHigherPriority(parent, index)) {
+			Swap(index, parent);
+			SiftUpLevels(parent, !min_level);
+			return;
+		}
+
+		SiftUpLevels(index, min_level);
+	}
+
+	protected void SiftUpLevels(int index, bool min_level)
+	{
+		while (index > 2) {
+			int grandparent = ((index - 1) / 2 - 1) / 2;
+			if (IsHigherPriority(index, grandparent) != min_level) {
+				return;
 			}
+
+			Swap(index, grandparent);
+			index = grandparent;
+		}
+	}
+
+	protected void SiftDown(int index)
+	{
+		int count = Count();
+		if (!m_MinMaxHeap) {
+			while (true) {
+				int child = index * 2 + 1;
+				if (child >= count) {
+					return;
+				}
+
+				if (child + 1 < count && IsHigherPriority(child + 1, child)) {
+					child++;
+				}
+
+				if (!IsHigherPriority(child, index)) {
+					return;
+				}
+
+				Swap(index, child);
+				index = child;
+			}
+		}
+
+		bool min_level = IsMinLevel(index);
+		while (index * 2 + 1 < count) {
+			// the most extreme of the children and grandchildren, for the kind of level index is on
+			int first_child = index * 2 + 1;
+			int extreme = first_child;
+			for (int i = first_child + 1; i < first_child + 2 && i < count; i++) {
+				if (IsHigherPriority(i, extreme) == min_level) {
+					extreme = i;
+				}
+			}
+
+			int first_grandchild = first_child * 2 + 1;
+			for (int j = first_grandchild; j < first_grandchild + 4 && j < count; j++) {
+				if (IsHigherPriority(j, extreme) == min_level) {
+					extreme = j;
+				}
+			}
+
+			if (IsHigherPriority(extreme, index) != min_level) {
+				return;
+			}
+
+			Swap(index, extreme);
+			if (extreme < first_grandchild) {
+				return;
+			}
+
+			// grandchildren sit on the same kind of level, make sure it still fits under its parent
+			int extreme_parent = (extreme - 1) / 2;
+			if (IsHigherPriority(extreme_parent, extreme) == min_level) {
+				Swap(extreme, extreme_parent);
+			}
+
+			index = extreme;
+		}
+	}
+
+	// the root is on a min level, levels alternate from there
+	protected bool IsMinLevel(int index)
+	{
+		int depth;
+		for (int n = index + 1; n > 1; n = n >> 1) {
+			depth++;
 		}
 
-		return lowestIndex;
+		return depth % 2 == 0;
 	}
 }
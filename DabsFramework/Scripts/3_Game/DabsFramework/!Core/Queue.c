@@ -1,3 +1,4 @@
+// Last in first out, see RingQueue for first in first out
 class Queue<Class T>: Managed
 {
 	static const T EMPTY;
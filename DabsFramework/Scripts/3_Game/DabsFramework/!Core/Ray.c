@@ -1,5 +1,8 @@
 class Ray: Managed
 {
+	// bounce rays of raycasts, see Raycast::Release
+	protected static ref ObjectPool<Ray> m_Pool = new ObjectPool<Ray>(64);
+	
 	vector Position;
 	vector Direction;
 	
@@ -9,6 +12,19 @@ class Ray: Managed
 		Direction = direction;
 	}
 	
+	static Ray Acquire(vector position = vector.Zero, vector direction = vector.Zero)
+	{
+		Ray ray = m_Pool.Acquire();
+		ray.Position = position;
+		ray.Direction = direction;
+		return ray;
+	}
+	
+	static void Release(Ray ray)
+	{
+		m_Pool.Release(ray);
+	}
+	
 	vector GetPoint(float distance)
 	{
 		return Position + Direction * distance;
@@ -16,15 +32,16 @@ class Ray: Managed
 	
 	Raycast PerformRaycast(Object ignore = null, float distance = 1000.0)
 	{
-		Ray output_ray = new Ray();
+		Ray output_ray = Acquire();
 		Object hit_object;
 		
 		float fraction;
 		if (!DayZPhysics.RayCastBullet(Position, Position + Direction.Normalized() * distance, PhxInteractionLayers.ROADWAY | PhxInteractionLayers.TERRAIN | PhxInteractionLayers.CHARACTER | PhxInteractionLayers.VEHICLE | PhxInteractionLayers.ITEM_LARGE | PhxInteractionLayers.ITEM_SMALL | PhxInteractionLayers.BUILDING | PhxInteractionLayers.DOOR, ignore, hit_object, output_ray.Position, output_ray.Direction, fraction)) {			
+			Release(output_ray);
 			return null;
 		}
 				
-		Raycast raycast = new Raycast();
+		Raycast raycast = Raycast.Acquire();
 		raycast.Source = this;
 		raycast.Bounce = output_ray;
 		raycast.Hit = hit_object;		
@@ -33,15 +50,16 @@ class Ray: Managed
 	
 	Raycast PerformRaycastRV(Object ignore = null, Object with = null, float radius = 0.0, float distance = 1000.0)
 	{
-		Ray output_ray = new Ray();
+		Ray output_ray = Acquire();
 		
 		set<Object> rv_results = new set<Object>();
 		int hit_component;
 		if (!DayZPhysics.RaycastRV(Position, Position + Direction.Normalized() * distance, output_ray.Position, output_ray.Direction, hit_component, rv_results, with, ignore, false, false, ObjIntersectFire | ObjIntersectGeom, radius)) {
+			Release(output_ray);
 			return null;
 		}
 		
-		Raycast raycast = new Raycast();
+		Raycast raycast = Raycast.Acquire();
 		raycast.Source = this;
 		raycast.Bounce = output_ray;
 		raycast.Hit = rv_results[0];	
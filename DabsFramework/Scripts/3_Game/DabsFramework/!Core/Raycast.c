@@ -1,11 +1,24 @@
 class Raycast: Managed
 {
+	protected static ref RaycastPool m_Pool = new RaycastPool(64);
+	
 	ref Ray Source;
 	ref Ray Bounce;
 	
 	Object Hit;
 	int HitComponent;
 	
+	static Raycast Acquire()
+	{
+		return m_Pool.Acquire();
+	}
+	
+	// optional, hands this raycast and its Bounce ray back for reuse by the next cast. dont touch either afterwards
+	void Release()
+	{
+		m_Pool.Release(this);
+	}
+	
 	float Length()
 	{
 		if  (!Source || !Bounce) {
@@ -31,4 +44,16 @@ class Raycast: Managed
 	{
 		return Source.PerformRaycast(ignore);
 	}
+}
+
+class RaycastPool: ObjectPool<Raycast>
+{
+	override protected void OnRelease(Raycast item)
+	{
+		Ray.Release(item.Bounce);
+		item.Source = null;
+		item.Bounce = null;
+		item.Hit = null;
+		item.HitComponent = 0;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,73 @@
+// First in first out queue on top of Deque, same calls as Queue (which is last in first out)
+// unlike Queue it holds strong references, queued objects stay alive until they are popped or cleared
+// bounded: pushing into a full queue drops the oldest entry, handy for keeping the last n samples
+class RingQueue<Class T>: Managed
+{
+	static const T EMPTY;
+
+	protected ref Deque<T> m_Values;
+
+	void RingQueue(int capacity = 0, bool bounded = false)
+	{
+		m_Values = new Deque<T>(capacity, bounded);
+	}
+
+	// removes and returns the oldest entry
+	T Pop()
+	{
+		return m_Values.PopFront();
+	}
+
+	// returns the oldest entry without removing it
+	T Peek()
+	{
+		return m_Values.PeekFront();
+	}
+
+	void Push(T value)
+	{
+		m_Values.PushBack(value);
+	}
+
+	// n counts from the oldest entry
+	void Set(int n, T value)
+	{
+		m_Values.Set(n, value);
+	}
+
+	T Get(int n)
+	{
+		return m_Values.Get(n);
+	}
+
+	// oldest first
+	array<T> ToArray()
+	{
+		return m_Values.ToArray();
+	}
+
+	int Count()
+	{
+		return m_Values.Count();
+	}
+
+	bool IsFull()
+	{
+		return m_Values.IsFull();
+	}
+
+	int GetCapacity()
+	{
+		return m_Values.GetCapacity();
+	}
+
+	void Clear()
+	{
+		m_Values.Clear();
+	}
+
+	typename GetType()
+	{
+		return T;
+	}
+}
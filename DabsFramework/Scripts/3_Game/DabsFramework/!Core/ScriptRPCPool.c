@@ -0,0 +1,13 @@
+// Reused rpcs, Reset clears the written data so an acquired rpc is as good as a new one
+class ScriptRPCPool: ObjectPool<ScriptRPC>
+{
+	override protected ScriptRPC Create()
+	{
+		return new ScriptRPC();
+	}
+
+	override protected void OnRelease(ScriptRPC item)
+	{
+		item.Reset();
+	}
+}
@@ -25,8 +25,7 @@ class ColorWidgetAnimationTimer: WidgetAnimationTimer
 	protected override void DoAnimate()
 	{
 		if (!m_Source) {
-			m_UpdateQueue.Remove(DoAnimate);
-			delete this;
+			Stop();
 			return;
 		}
 		
@@ -41,11 +40,9 @@ class ColorWidgetAnimationTimer: WidgetAnimationTimer
 				return;
 			}
 			
-			m_UpdateQueue.Remove(DoAnimate);
-
 			// finally set end value to make sure it was completed
 			m_Source.SetColor(m_EndValueColor);
-			delete this;
+			Stop();
 		}
 	}
 }
@@ -79,11 +76,18 @@ class WidgetAnimationTimer: Managed
 		m_UpdateQueue.Insert(DoAnimate);
 	}
 	
+	// ends the animation, timers started by WidgetAnimator go back to its pool
+	void Stop()
+	{
+		m_UpdateQueue.Remove(DoAnimate);
+		m_Source = null;
+		WidgetAnimator.OnTimerStopped(this);
+	}
+	
 	protected void DoAnimate()
 	{
 		if (!m_Source) {
-			m_UpdateQueue.Remove(DoAnimate);
-			delete this;
+			Stop();
 			return;
 		}
 		
@@ -102,11 +106,9 @@ class WidgetAnimationTimer: Managed
 				return;
 			}
 			
-			m_UpdateQueue.Remove(DoAnimate);
-
 			// finally set end value to make sure it was completed
 			SetProperty(m_Source, m_Property, m_EndValue);
-			delete this;
+			Stop();
 		}
 	}
 	
@@ -14,6 +14,10 @@ class WidgetAnimator: Managed
 {
 	protected static ref array<ref WidgetAnimationTimer> m_RunningTimers = {};
 	
+	// finished timers come back here, see WidgetAnimationTimer::Stop
+	protected static ref ObjectPool<WidgetAnimationTimer> m_TimerPool = new ObjectPool<WidgetAnimationTimer>(32);
+	protected static ref ObjectPool<ColorWidgetAnimationTimer> m_ColorTimerPool = new ObjectPool<ColorWidgetAnimationTimer>(16);
+	
 	static void Animate(Widget source, WidgetAnimatorProperty property, float end_value, TimeSpan time)
 	{				
 		if (!source) {
@@ -24,7 +28,7 @@ class WidgetAnimator: Managed
 			CancelAnimate(source, property);
 		}
 		
-		WidgetAnimationTimer animation_timer = new WidgetAnimationTimer();
+		WidgetAnimationTimer animation_timer = m_TimerPool.Acquire();
 		animation_timer.Run(source, property, WidgetAnimationTimer.GetProperty(source, property), end_value, time, false);
 		m_RunningTimers.Insert(animation_timer);
 	}
@@ -39,7 +43,7 @@ class WidgetAnimator: Managed
 			CancelAnimate(source, property);
 		}
 		
-		WidgetAnimationTimer animation_timer = new WidgetAnimationTimer();
+		WidgetAnimationTimer animation_timer = m_TimerPool.Acquire();
 		animation_timer.Run(source, property, start_value, end_value, time, false);
 		m_RunningTimers.Insert(animation_timer);
 	}
@@ -54,7 +58,7 @@ class WidgetAnimator: Managed
 			CancelAnimate(source, property);
 		}
 		
-		WidgetAnimationTimer animation_timer = new WidgetAnimationTimer();
+		WidgetAnimationTimer animation_timer = m_TimerPool.Acquire();
 		animation_timer.Run(source, property, WidgetAnimationTimer.GetProperty(source, property), end_value, time, true);
 		m_RunningTimers.Insert(animation_timer);
 	}
@@ -69,7 +73,7 @@ class WidgetAnimator: Managed
 			CancelAnimate(source, property);
 		}
 		
-		WidgetAnimationTimer animation_timer = new WidgetAnimationTimer();
+		WidgetAnimationTimer animation_timer = m_TimerPool.Acquire();
 		animation_timer.Run(source, property, start_value, end_value, time, true);
 		m_RunningTimers.Insert(animation_timer);
 	}
@@ -86,7 +90,7 @@ class WidgetAnimator: Managed
 		}
 
 		if (source.GetColor() != end_color) {
-			ColorWidgetAnimationTimer animation_timer = new ColorWidgetAnimationTimer();
+			ColorWidgetAnimationTimer animation_timer = m_ColorTimerPool.Acquire();
 			animation_timer.RunWithBlend(source, property, source.GetColor(), end_color, blend_mode, time, loop);
 			m_RunningTimers.Insert(animation_timer);
 		}
@@ -104,7 +108,7 @@ class WidgetAnimator: Managed
 		}
 
 		if (start_color != end_color) {
-			ColorWidgetAnimationTimer animation_timer = new ColorWidgetAnimationTimer();
+			ColorWidgetAnimationTimer animation_timer = m_ColorTimerPool.Acquire();
 			animation_timer.RunWithBlend(source, property, start_color, end_color, blend_mode, time, loop);
 			m_RunningTimers.Insert(animation_timer);
 		}
@@ -118,7 +122,7 @@ class WidgetAnimator: Managed
 
 		WidgetAnimatorProperty property = WidgetAnimatorProperty.COLOR_V;
 		for (int i = 2; i >= 0; i--) {
-			WidgetAnimationTimer hue_timer = new WidgetAnimationTimer();
+			WidgetAnimationTimer hue_timer = m_TimerPool.Acquire();
 			hue_timer.Run(source, property, start_color[i], end_color[i], time, loop);
 			m_RunningTimers.Insert(hue_timer);
 			property /= 2;
@@ -138,12 +142,30 @@ class WidgetAnimator: Managed
 					WidgetAnimationTimer.SetProperty(source, widget_animation_timer.GetWidgetAnimatorProperty(), widget_animation_timer.GetStartValue());
 				}
 
-				delete widget_animation_timer;
+				widget_animation_timer.Stop();
 				return;
 			}
 		}
 	}
 		
+	// Called by WidgetAnimationTimer::Stop, timers this class didnt start are left to their owner
+	static void OnTimerStopped(WidgetAnimationTimer animation_timer)
+	{
+		int index = m_RunningTimers.Find(animation_timer);
+		if (index == -1) {
+			return;
+		}
+		
+		// into the pool before the running list lets go of it
+		if (animation_timer.Type() == ColorWidgetAnimationTimer) {
+			m_ColorTimerPool.Release(ColorWidgetAnimationTimer.Cast(animation_timer));
+		} else if (animation_timer.Type() == WidgetAnimationTimer) {
+			m_TimerPool.Release(animation_timer);
+		}
+		
+		m_RunningTimers.Remove(index);
+	}
+	
 	static WidgetAnimatorProperty GetAnimations(Widget source)
 	{		
 		WidgetAnimatorProperty properties;
@@ -17,20 +17,33 @@ typedef map<int, ref EventBase> EventMap;
 
 class EventBase: Managed
 {
+	// deprecated, phases end exactly on their deadline now
 	static const float PHASE_TIME_REMAINING_PRECISION = 1.0;
 	
+	// subscribe to this in GetRPCSubscriptions to receive every rpc the game gets, not recommended
+	static const int RPC_ALL = -1;
+	
 	protected int m_Id;
 	protected EventManager m_EventManager;
 	protected ref Param m_StartParams; // startup params, passed from EventManager::StartEvent
 	protected bool m_IsPaused;
 	protected EventPhase m_EventPhase = EventPhase.INVALID; // starting at -1 will let it naturally reach 0 when the Start function is called
-	protected float m_PhaseTimeRemaining;
+	
+	// phases are tracked as deadlines against EventManager time, remaining time is computed when asked for
+	protected float m_PhaseDeadline; // time the current phase ends, not counting pauses
+	protected float m_PhasePausedTime; // total time spent paused during the current phase
+	protected float m_PauseStartTime;
+	protected float m_PhaseStartTime; // metrics only
 	
 	protected Weather m_Weather;
+	
+	// Server: identity ids of the clients inside GetRelevancyArea, only used for localized events
+	protected ref set<string> m_RelevantClients = new set<string>();
 
-	// used for client / server update abstraction
-	protected ref Timer m_ClientUpdate = new Timer(CALL_CATEGORY_GAMEPLAY);
-	protected ref Timer m_ServerUpdate = new Timer(CALL_CATEGORY_GAMEPLAY);
+	// used for client / server update abstraction, driven by the EventManager scheduler
+	protected ref EventBaseTask m_ClientUpdate;
+	protected ref EventBaseTask m_ServerUpdate;
+	protected ref EventBaseTask m_PhaseEnd;
 	
 	void EventBase()
 	{
@@ -40,11 +53,12 @@ class EventBase: Managed
 		m_Weather = GetGame().GetWeather();
 		
 		if (!GetGame().IsDedicatedServer()) {
-			m_ClientUpdate.Run(GetClientTick(), this, "UpdateClient", null, true);
+			m_ClientUpdate = new EventBaseTask(this, EventTaskType.CLIENT_UPDATE, GetClientTick());
 		}
 				
 		if (GetGame().IsServer()) {
-			m_ServerUpdate.Run(GetServerTick(), this, "UpdateServer", null, true);
+			m_ServerUpdate = new EventBaseTask(this, EventTaskType.SERVER_UPDATE, GetServerTick());
+			m_PhaseEnd = new EventBaseTask(this, EventTaskType.PHASE_END);
 		}
 	}
 	
@@ -52,14 +66,15 @@ class EventBase: Managed
 	void ~EventBase()
 	{
 		EventManagerLog.Debug(this, "~Destroy");
-		m_EventManager.DeleteEvent(this);
+		if (m_EventManager) {
+			m_EventManager.DeleteEvent(this);
+		}
+		
+		UnscheduleTasks();
 		delete m_StartParams;		
 		delete m_ClientUpdate;		
 		delete m_ServerUpdate;
-		
-		if (GetGame() && GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY)) {
-			GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY).Remove(UpdateTimeRemaining);
-		}
+		delete m_PhaseEnd;
 	}
 		
 	// Abstract methods
@@ -81,8 +96,46 @@ class EventBase: Managed
 	// Corresponds to the `client_data` parameter of event calls
 	SerializableParam GetClientSyncData(EventPhase phase);
 	
+	// Only called for the rpc types returned by GetRPCSubscriptions
 	void OnRPC(PlayerIdentity sender, Object target, int rpc_type, ParamsReadContext ctx);
 	
+	// rpc types this event wants OnRPC called for, read once when the event becomes active
+	/*
+		override TIntArray GetRPCSubscriptions()
+		{
+			return { ERPCsMyMod.STORM_STRIKE, ERPCsMyMod.STORM_SIREN };
+		}
+	*/
+	TIntArray GetRPCSubscriptions()
+	{
+		return {};
+	}
+	
+	// Area players need to be in to receive this event, null (the default) syncs it to everyone
+	// re-checked periodically by the EventManager, so moving areas are fine
+	/*
+		override PositionWithRadius2D GetRelevancyArea()
+		{
+			return new PositionWithRadius2D(m_StormCenter, 1500);
+		}
+	*/
+	PositionWithRadius2D GetRelevancyArea()
+	{
+		return null;
+	}
+	
+	// distance past the edge of GetRelevancyArea a player has to travel before the event is removed on their client
+	// keeps players walking along the edge from having the event spawned and deleted over and over
+	float GetRelevancyMargin()
+	{
+		return 50.0;
+	}
+	
+	set<string> GetRelevantClients()
+	{
+		return m_RelevantClients;
+	}
+	
 	// Triggers a function call on this class on all clients
 	bool CallFunctionOnClient(string function_name, SerializableParam params, PlayerIdentity identity = null)
 	{
@@ -136,19 +189,29 @@ class EventBase: Managed
 			return;
 		}
 		
+		// how long the phase we are leaving actually took
+		if (GetGame().IsServer() && m_EventPhase >= EventPhase.INIT && m_EventPhase < EventPhase.DELETE) {
+			m_EventManager.GetMetrics().OnPhaseEnded(Type(), GetTime() - m_PhaseStartTime, GetCurrentPhaseLength());
+		}
+		
 		m_EventPhase = phase;
 		EventManagerLog.Debug(this, "SwitchPhase %1, length: %2", typename.EnumToString(EventPhase, m_EventPhase), time_remaining.ToString());
 		
+		// clients are told how long the phase has left, the server is the one deciding it
+		if (GetGame().IsServer()) {
+			StartPhaseTimer(GetPhaseLength(phase));
+		} else {
+			StartPhaseTimer(time_remaining);
+		}
+		
 		// This was in Start() but it was not being called on clients so i moved it here
-		// there may be some better ways to do this, if so, acquire cookie		
-		GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY).Remove(UpdateTimeRemaining);
-		GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY).CallLater(UpdateTimeRemaining, PHASE_TIME_REMAINING_PRECISION * 1000, true);
+		// schedules the end of the new phase, and starts the update loops on the first phase
+		ScheduleTasks();
 		
-		if (GetGame().IsServer()) {		
-			m_PhaseTimeRemaining = GetPhaseLength(phase);
-			
+		if (GetGame().IsServer()) {
 			// Dispatch data to all clients
 			SyncToClient(null);
+			m_EventManager.MarkCheckpointDirty();
 						
 			switch (m_EventPhase) {
 				case EventPhase.INIT: {
@@ -176,7 +239,6 @@ class EventBase: Managed
 		}
 		
 		if (GetGame().IsClient() || !GetGame().IsMultiplayer()) {	
-			m_PhaseTimeRemaining = time_remaining;		
 			switch (m_EventPhase) {
 				case EventPhase.INIT: {
 					thread InitPhaseClient(time_remaining, client_data);
@@ -205,13 +267,40 @@ class EventBase: Managed
 		
 	float GetCurrentPhaseTimeRemaining()
 	{
-		return m_PhaseTimeRemaining;
+		float time = GetTime();
+		float deadline = m_PhaseDeadline + m_PhasePausedTime;
+		
+		// the clock stops while paused
+		if (m_IsPaused) {
+			deadline += time - m_PauseStartTime;
+		}
+		
+		return Math.Max(deadline - time, 0);
 	}
 	
 	// Good lord shorten this
 	float GetCurrentPhaseTimeRemainingNormalized()
 	{
-		return m_PhaseTimeRemaining / GetCurrentPhaseLength();
+		return GetCurrentPhaseTimeRemaining() / GetCurrentPhaseLength();
+	}
+	
+	protected void StartPhaseTimer(float time_remaining)
+	{
+		float time = GetTime();
+		m_PhaseDeadline = time + time_remaining;
+		m_PhasePausedTime = 0;
+		m_PauseStartTime = time;
+		m_PhaseStartTime = time;
+	}
+	
+	// EventManager time, see EventManager::GetTime
+	protected float GetTime()
+	{
+		if (!m_EventManager) {
+			return 0;
+		}
+		
+		return m_EventManager.GetTime();
 	}
 		
 	bool EventActivateCondition()
@@ -249,6 +338,18 @@ class EventBase: Managed
 		return 0.01;
 	}
 	
+	// when EventManager::SetServerUpdateBudget is used, higher priority updates are the last to be pushed back a frame
+	int GetServerUpdatePriority()
+	{
+		return 0;
+	}
+	
+	// Called by the EventManager, dont call this directly
+	void RunServerUpdate()
+	{
+		UpdateServer();
+	}
+	
 	// a minimum time between each of these events
 	// return: value in seconds
 	float GetEventCooldown()
@@ -263,6 +364,38 @@ class EventBase: Managed
 		
 		SwitchPhase(EventPhase.INIT);
 	}
+	
+	// Should this event pick up where it left off after a server restart? otherwise it is dropped when the checkpoint is restored
+	bool CanResume()
+	{
+		return false;
+	}
+	
+	// Called on the server for checkpointed events that cannot resume, before they are dropped
+	// the event was never started in this session, clean up whatever the last session left behind (spawned objects etc.)
+	void OnDiscardCheckpoint(EventPhase phase, Param start_params)
+	{
+	}
+	
+	// start_params in a form that can be saved to the checkpoint, restored through ToParam() when resuming
+	SerializableParam GetCheckpointParams()
+	{
+		return null;
+	}
+	
+	// Called instead of OnStart when the event is restored from a checkpoint, only the server phase that was active is run again
+	void OnResume(EventPhase phase, float time_remaining, bool paused, Param start_params)
+	{
+		m_StartParams = start_params;
+		
+		SwitchPhase(phase);
+		StartPhaseTimer(time_remaining);
+		if (paused) {
+			SetPaused(true);
+		} else {
+			ScheduleTasks();
+		}
+	}
 		
 	void SetID(int id)
 	{
@@ -282,7 +415,16 @@ class EventBase: Managed
 			return;
 		}
 		
+		// push the deadline back by however long we were paused
+		if (state && !m_IsPaused) {
+			m_PauseStartTime = GetTime();
+		} else if (!state && m_IsPaused) {
+			m_PhasePausedTime += GetTime() - m_PauseStartTime;
+		}
+		
 		m_IsPaused = state;
+		ScheduleTasks();
+		m_EventManager.MarkCheckpointDirty();
 				
 		EventManagerLog.Debug(this, "Sending Event Pause Data, idx: %2, Paused: %3", GetID().ToString(), m_IsPaused.ToString());
 		SyncToClient(null);
@@ -299,49 +441,127 @@ class EventBase: Managed
 		return {};
 	}
 		
-	protected void UpdateTimeRemaining()
-	{		
-		// Dont try to decrease value if paused
-		if (IsPaused()) {
+	// Called by the EventManager scheduler, dont call this directly
+	void OnScheduledTask(EventTaskType task_type)
+	{
+		switch (task_type) {
+			case EventTaskType.CLIENT_UPDATE: {
+				UpdateClient();
+				break;
+			}
+			
+			case EventTaskType.SERVER_UPDATE: {
+				// goes through the EventManager, which can push it back a frame when the update budget is spent
+				m_EventManager.RequestServerUpdate(this);
+				break;
+			}
+			
+			case EventTaskType.PHASE_END: {
+				OnPhaseEnd();
+				break;
+			}
+		}
+	}
+	
+	// Clients rebuild their phase deadline from every update the server sends
+	// the client does not have authority to pause events directly, so this is the only way in
+	void OnServerSync(float time_remaining, bool paused)
+	{
+		m_IsPaused = paused;
+		StartPhaseTimer(time_remaining);
+		ScheduleTasks();
+	}
+	
+	// (Re)starts the scheduled update loops and the phase deadline, paused events are taken off the scheduler entirely
+	void ScheduleTasks()
+	{
+		if (!m_EventManager || !m_EventManager.GetScheduler()) {
 			return;
 		}
 		
-		m_PhaseTimeRemaining -= PHASE_TIME_REMAINING_PRECISION;
-		if (m_PhaseTimeRemaining <= 0) {
-			m_PhaseTimeRemaining = 0;
-			
-			if (GetGame().IsServer()) {
-				EventManagerLog.Debug(this, "Attempting to naturally switch to the next phase");
-				SwitchPhase(GetCurrentPhase() + 1);
-			}
+		if (IsPaused() || m_EventPhase == EventPhase.INVALID) {
+			UnscheduleTasks();
+			return;
 		}
+		
+		EventScheduler scheduler = m_EventManager.GetScheduler();
+		if (m_ClientUpdate && !m_ClientUpdate.IsScheduled()) {
+			scheduler.Schedule(m_ClientUpdate, GetClientTick());
+		}
+		
+		if (m_ServerUpdate && !m_ServerUpdate.IsScheduled()) {
+			scheduler.Schedule(m_ServerUpdate, GetServerTick());
+		}
+		
+		// only the server moves events between phases
+		if (m_PhaseEnd) {
+			scheduler.Schedule(m_PhaseEnd, GetCurrentPhaseTimeRemaining());
+		}
+	}
+	
+	void UnscheduleTasks()
+	{
+		if (!m_EventManager || !m_EventManager.GetScheduler()) {
+			return;
+		}
+		
+		EventScheduler scheduler = m_EventManager.GetScheduler();
+		scheduler.Cancel(m_ClientUpdate);
+		scheduler.Cancel(m_ServerUpdate);
+		scheduler.Cancel(m_PhaseEnd);
+	}
+		
+	// Scheduled exactly on the phase deadline
+	protected void OnPhaseEnd()
+	{		
+		// Dont try to switch if paused
+		if (IsPaused() || !GetGame().IsServer()) {
+			return;
+		}
+		
+		EventManagerLog.Debug(this, "Attempting to naturally switch to the next phase");
+		SwitchPhase(GetCurrentPhase() + 1);
 	}
 	
 	// syncs a full package of this event to the client
 	void SyncToClient(PlayerIdentity identity)
 	{
 		EventManagerLog.Debug(this, "Sending active Event Data: %1, idx: %2, Phase: %3", Type().ToString(), GetID().ToString(), typename.EnumToString(EventPhase, GetCurrentPhase()));		
-		ScriptRPC rpc = new ScriptRPC();
-		Print(Type());
-		typename type = Type();
-		string type_string = type.ToString();
-		Print(type_string);
-		rpc.Write(type_string);
-		rpc.Write(GetID());
-		rpc.Write(GetCurrentPhase());
-		rpc.Write(GetCurrentPhaseTimeRemaining());
-		rpc.Write(IsPaused());
+		ScriptRPC rpc = m_EventManager.AcquireRPC();
 		
-		// handle data
-		SerializableParam data = GetClientSyncData(GetCurrentPhase());
-		if (data) {
-			rpc.Write(data.GetSerializeableType());
-			data.Write(rpc);
-		} else {
-			rpc.Write("null");
+		// broadcasts change what every client holds, single clients are just catching up
+		int generation = m_EventManager.GetSnapshotGeneration();
+		if (!identity) {
+			generation = m_EventManager.AdvanceSnapshotGeneration();
 		}
+		
+		rpc.Write(generation);
+		int size = 4 + WriteState(rpc);
+		
+		// localized events only go to the clients inside their area
+		m_EventManager.SendEventRPC(this, rpc, ERPCsDabsFramework.EVENT_UPDATE, identity, size);
+		m_EventManager.ReleaseRPC(rpc);
+	}
+	
+	// the full state of this event, read by EventManager::ReadEventState
+	// returns the estimated amount of bytes written
+	int WriteState(Serializer ctx)
+	{
+		return WriteState(ctx, GetCurrentPhase());
+	}
 	
-		rpc.Send(null, ERPCsDabsFramework.EVENT_UPDATE, true, identity);		 
+	// same as above, but reporting 'phase' instead of the current one. used to remove the event from clients that left its area
+	int WriteState(Serializer ctx, EventPhase phase)
+	{
+		EventRpcRegistry rpc_registry = m_EventManager.GetRpcRegistry();
+		ctx.Write(rpc_registry.GetEventTypeId(Type()));
+		ctx.Write(GetID());
+		ctx.Write(phase);
+		ctx.Write(GetCurrentPhaseTimeRemaining());
+		ctx.Write(IsPaused());
+		
+		// handle data
+		return 20 + rpc_registry.WriteParam(ctx, GetClientSyncData(phase));
 	}
 	
 	// some helpers that i use constantly
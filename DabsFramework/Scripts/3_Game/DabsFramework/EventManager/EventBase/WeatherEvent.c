@@ -13,8 +13,20 @@
 
 class WeatherEvent: EventBase
 {
+	void ~WeatherEvent()
+	{
+		if (m_EventManager && m_EventManager.GetWeatherArbiter()) {
+			m_EventManager.GetWeatherArbiter().Remove(this);
+		}
+	}
+	
 	override void SwitchPhase(EventPhase phase, float time_remaining = 0, Param client_data = null)
 	{
+		// has to happen before super, entering DELETE destroys the event
+		if (GetGame().IsServer() && phase > m_EventPhase && phase <= EventPhase.DELETE) {
+			m_EventManager.GetWeatherArbiter().OnPhaseChanged(this, phase);
+		}
+		
 		super.SwitchPhase(phase, time_remaining, client_data);
 				
 		if (!GetGame().IsServer()) {
@@ -53,13 +65,12 @@ class WeatherEvent: EventBase
 			
 			case EventPhase.DELETE: {
 				for (int k = EWeatherPhenomenon.OVERCAST; k <= EWeatherPhenomenon.RAIN; k++) {
-					WeatherPhenomenon weather_phenom = GetWeatherPhenomenon(k);
 					float highest_value_delete = GetHighestRemainingWeatherValue(k);
 					if (highest_value_delete == 0 && k == EWeatherPhenomenon.OVERCAST) {
 						highest_value_delete = 0.15; // Keeps things spicy
 					}
 					
-					weather_phenom.SetLimits(0, highest_value_delete);
+					m_EventManager.GetWeatherArbiter().SetLimits(k, 0, highest_value_delete);
 				}
 				break;
 			}
@@ -108,39 +119,32 @@ class WeatherEvent: EventBase
 	protected bool RequestWeatherChange(EWeatherPhenomenon weather_type, float change, float time, float duration)
 	{
 		EventManagerLog.Debug(this, "Requested Weather Change %1, value %2", typename.EnumToString(EWeatherPhenomenon, weather_type), change.ToString());		
-		array<EventBase> active_events = EventManager.GetInstance().GetActiveEvents();
-		foreach (EventBase fog_event: active_events) {
-			WeatherEvent weather_event;
-			if (Class.CastTo(weather_event, fog_event)) {
-				if (weather_event != this && weather_event.GetWeatherTarget(weather_type) != -1) {
-					if (change < weather_event.GetWeatherTarget(weather_type) && weather_event.GetCurrentPhase() <= EventPhase.MID) {
-						EventManagerLog.Debug(this, "Weather Change Request Denied");
-						return false;
-					}
-				}
-			}
+		// another event in INIT or MID is holding this phenomenon higher
+		EventWeatherArbiter weather_arbiter = m_EventManager.GetWeatherArbiter();
+		if (change < weather_arbiter.GetCeiling(weather_type, this)) {
+			EventManagerLog.Debug(this, "Weather Change Request Denied");
+			return false;
 		}
 				
 		EventManagerLog.Debug(this, "Weather Change Approved");
-		WeatherPhenomenon weather_phenomenon = GetWeatherPhenomenon(weather_type);
-		if (!weather_phenomenon) {
+		if (!GetWeatherPhenomenon(weather_type)) {
 			Error("Invalid Weather Phenomenon");
 			return false;
 		}
 				
 		// adjust limits
 		float low, high;
-		weather_phenomenon.GetLimits(low, high);
+		weather_arbiter.GetLimits(weather_type, low, high);
 		
 		// we only want this value to go higher if the requested change is higher than something already active
 		// we let the lower value changes occur in OnEventEndServer
 		if (change > high) {
 			EventManagerLog.Debug(this, "Changing limits to [0, %2]", low.ToString(), change.ToString());			
-			weather_phenomenon.SetLimits(0, change);
+			weather_arbiter.SetLimits(weather_type, 0, change);
 		}
 		
-		// Set weather to value
-		weather_phenomenon.Set(change, time, duration);
+		// Set weather to value, applied at the end of the frame with any other request for it
+		weather_arbiter.Set(weather_type, change, time, duration);
 		return true;
 	}
 	
@@ -149,21 +153,6 @@ class WeatherEvent: EventBase
 		// This does a few important things	//
 		// 1. Grabs ceiling weather value
 		// 2. If this is the last running event, value will be zero (back to sunny day)
-		array<EventBase> active_events = m_EventManager.GetActiveEvents();
-		float value = 0;
-		foreach (EventBase active_event: active_events) {
-			if (!active_event || active_event == this || active_event.GetCurrentPhase() > EventPhase.MID) {
-				continue;
-			}
-			
-			WeatherEvent weather_event;
-			if (Class.CastTo(weather_event, active_event)) {
-				if (value <= weather_event.GetWeatherTarget(change_type)) {
-					value = weather_event.GetWeatherTarget(change_type);
-				}
-			}	
-		}
-		
-		return value;
+		return m_EventManager.GetWeatherArbiter().GetCeiling(change_type, this);
 	}
 }
\ No newline at end of file
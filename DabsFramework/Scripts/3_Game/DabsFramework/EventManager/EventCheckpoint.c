@@ -0,0 +1,181 @@
+/*
+*
+*	EventCheckpoint.c
+*
+*	Binary snapshot of the EventManager state, used to resume events across server restarts
+*
+*	You are free to mod this as you please.
+*
+*	That being said you are NOT free to redistribute / repack this into
+*	your own mod.
+*
+*/
+
+class EventCheckpointEntry: SerializableBase
+{
+	typename EventType;
+	int ID;
+	EventPhase Phase;
+	float TimeRemaining;
+	bool Paused;
+	ref SerializableParam StartParams; // EventBase::GetCheckpointParams, can be null
+
+	override void Write(Serializer serializer, int version)
+	{
+		serializer.Write(EventType.ToString());
+		serializer.Write(ID);
+		serializer.Write(Phase);
+		serializer.Write(TimeRemaining);
+		serializer.Write(Paused);
+
+		string param_type;
+		if (StartParams) {
+			param_type = StartParams.GetSerializeableType();
+		}
+
+		serializer.Write(param_type);
+		if (StartParams) {
+			StartParams.Write(serializer);
+		}
+	}
+
+	// EventType is left null when the event no longer exists, the entry is still read so the file stays aligned
+	override bool Read(Serializer serializer, int version)
+	{
+		string event_type, param_type;
+		if (!serializer.Read(event_type) || !serializer.Read(ID) || !serializer.Read(Phase) || !serializer.Read(TimeRemaining) || !serializer.Read(Paused) || !serializer.Read(param_type)) {
+			return false;
+		}
+
+		EventType = event_type.ToType();
+		if (param_type == string.Empty) {
+			return true;
+		}
+
+		// no way to skip over data we cant read
+		StartParams = SerializableParam.Cast(param_type.ToType().Spawn());
+		if (!StartParams) {
+			return false;
+		}
+
+		return StartParams.Read(serializer);
+	}
+}
+
+class EventCheckpoint: SerializableBase
+{
+	static const int VERSION = 1;
+	static const string FILE_NAME = "$profile:\\EventCheckpoint.bin";
+
+	ref map<typename, int> RunCounts = new map<typename, int>();
+	ref map<typename, float> Cooldowns = new map<typename, float>(); // seconds remaining
+	ref array<ref EventCheckpointEntry> Events = {};
+
+	override void Write(Serializer serializer, int version)
+	{
+		serializer.Write(RunCounts.Count());
+		foreach (typename run_type, int run_count: RunCounts) {
+			serializer.Write(run_type.ToString());
+			serializer.Write(run_count);
+		}
+
+		serializer.Write(Cooldowns.Count());
+		foreach (typename cooldown_type, float cooldown: Cooldowns) {
+			serializer.Write(cooldown_type.ToString());
+			serializer.Write(cooldown);
+		}
+
+		serializer.Write(Events.Count());
+		foreach (EventCheckpointEntry entry: Events) {
+			entry.Write(serializer, version);
+		}
+	}
+
+	override bool Read(Serializer serializer, int version)
+	{
+		int count;
+		if (!serializer.Read(count)) {
+			return false;
+		}
+
+		for (int i = 0; i < count; i++) {
+			string run_type;
+			int run_count;
+			if (!serializer.Read(run_type) || !serializer.Read(run_count)) {
+				return false;
+			}
+
+			if (run_type.ToType()) {
+				RunCounts[run_type.ToType()] = run_count;
+			}
+		}
+
+		if (!serializer.Read(count)) {
+			return false;
+		}
+
+		for (int j = 0; j < count; j++) {
+			string cooldown_type;
+			float cooldown;
+			if (!serializer.Read(cooldown_type) || !serializer.Read(cooldown)) {
+				return false;
+			}
+
+			if (cooldown_type.ToType()) {
+				Cooldowns[cooldown_type.ToType()] = cooldown;
+			}
+		}
+
+		if (!serializer.Read(count)) {
+			return false;
+		}
+
+		for (int k = 0; k < count; k++) {
+			EventCheckpointEntry entry = new EventCheckpointEntry();
+			if (!entry.Read(serializer, version)) {
+				return false;
+			}
+
+			Events.Insert(entry);
+		}
+
+		return true;
+	}
+
+	bool Save(string file = FILE_NAME)
+	{
+		FileSerializer serializer = new FileSerializer();
+		if (!serializer.Open(file, FileMode.WRITE)) {
+			return false;
+		}
+
+		int version = VERSION;
+		serializer.Write(version);
+		Write(serializer, version);
+		serializer.Close();
+		return true;
+	}
+
+	// null when there is no checkpoint, or it could not be read
+	static EventCheckpoint Load(string file = FILE_NAME)
+	{
+		if (!FileExist(file)) {
+			return null;
+		}
+
+		FileSerializer serializer = new FileSerializer();
+		if (!serializer.Open(file, FileMode.READ)) {
+			return null;
+		}
+
+		EventCheckpoint checkpoint = new EventCheckpoint();
+		int version;
+		if (!serializer.Read(version) || version > VERSION || !checkpoint.Read(serializer, version)) {
+			serializer.Close();
+			return null;
+		}
+
+		serializer.Close();
+		return checkpoint;
+	}
+}
@@ -0,0 +1,150 @@
+/*
+*
+*	EventCooldownTracker.c
+*
+*	Cooldown index for the EventManager, keyed on absolute expiry time
+*
+*	You are free to mod this as you please.
+*
+*	That being said you are NOT free to redistribute / repack this into
+*	your own mod.
+*
+*/
+
+class EventCooldownTracker: Managed
+{
+	// binary min-heap ordered on expiry, m_HeapExpiries[0] is always the next cooldown to run out
+	protected ref array<float> m_HeapExpiries = {};
+	protected ref array<typename> m_HeapTypes = {};
+
+	// the live expiry of each type, heap entries that dont match this were replaced and are skipped
+	protected ref map<typename, float> m_Expiries = new map<typename, float>();
+
+	// puts event_type on cooldown until 'expiry', an existing longer cooldown is kept
+	void Start(typename event_type, float expiry)
+	{
+		if (m_Expiries.Contains(event_type) && m_Expiries[event_type] >= expiry) {
+			return;
+		}
+
+		m_Expiries[event_type] = expiry;
+		Push(event_type, expiry);
+	}
+
+	void Remove(typename event_type)
+	{
+		// the heap entry goes stale and gets dropped when it reaches the top
+		m_Expiries.Remove(event_type);
+	}
+
+	// drops every cooldown that has run out by 'time', O(1) when nothing expired
+	void Update(float time)
+	{
+		while (m_HeapExpiries.Count() > 0 && m_HeapExpiries[0] <= time) {
+			typename event_type = m_HeapTypes[0];
+			float expiry = m_HeapExpiries[0];
+			Pop();
+
+			if (m_Expiries.Contains(event_type) && m_Expiries[event_type] == expiry) {
+				m_Expiries.Remove(event_type);
+			}
+		}
+	}
+
+	// seconds left on the cooldown of event_type, 0 when not on cooldown. does not modify anything
+	float GetRemaining(typename event_type, float time)
+	{
+		if (!m_Expiries.Contains(event_type)) {
+			return 0;
+		}
+
+		return Math.Max(m_Expiries[event_type] - time, 0);
+	}
+
+	bool IsOnCooldown(typename event_type, float time)
+	{
+		return GetRemaining(event_type, time) > 0;
+	}
+
+	// snapshot of every type currently on cooldown, and the seconds remaining on each
+	map<typename, float> GetCooldowns(float time)
+	{
+		map<typename, float> cooldowns = new map<typename, float>();
+		foreach (typename event_type, float expiry: m_Expiries) {
+			if (expiry > time) {
+				cooldowns[event_type] = expiry - time;
+			}
+		}
+
+		return cooldowns;
+	}
+
+	int Count()
+	{
+		return m_Expiries.Count();
+	}
+
+	void Clear()
+	{
+		m_HeapExpiries.Clear();
+		m_HeapTypes.Clear();
+		m_Expiries.Clear();
+	}
+
+	protected void Push(typename event_type, float expiry)
+	{
+		int index = m_HeapExpiries.Insert(expiry);
+		m_HeapTypes.Insert(event_type);
+
+		while (index > 0) {
+			int parent = (index - 1) / 2;
+			if (m_HeapExpiries[parent] <= m_HeapExpiries[index]) {
+				break;
+			}
+
+			Swap(index, parent);
+			index = parent;
+		}
+	}
+
+	protected void Pop()
+	{
+		int last = m_HeapExpiries.Count() - 1;
+		Swap(0, last);
+		m_HeapExpiries.Remove(last);
+		m_HeapTypes.Remove(last);
+
+		int count = m_HeapExpiries.Count();
+		int index;
+		while (true) {
+			int smallest = index;
+			int left = index * 2 + 1;
+			int right = left + 1;
+			if (left < count && m_HeapExpiries[left] < m_HeapExpiries[smallest]) {
+				smallest = left;
+			}
+
+			if (right < count && m_HeapExpiries[right] < m_HeapExpiries[smallest]) {
+				smallest = right;
+			}
+
+			if (smallest == index) {
+				break;
+			}
+
+			Swap(index, smallest);
+			index = smallest;
+		}
+	}
+
+	protected void Swap(int a, int b)
+	{
+		float expiry = m_HeapExpiries[a];
+		m_HeapExpiries[a] = m_HeapExpiries[b];
+		m_HeapExpiries[b] = expiry;
+
+		typename event_type = m_HeapTypes[a];
+		m_HeapTypes[a] = m_HeapTypes[b];
+		m_HeapTypes[b] = event_type;
+	}
+}
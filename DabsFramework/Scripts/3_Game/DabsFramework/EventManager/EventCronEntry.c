@@ -0,0 +1,33 @@
+/*
+*
+*	EventCronEntry.c
+*
+*	An event started on a wall-clock schedule, see EventManager::ScheduleEvent
+*
+*	You are free to mod this as you please.
+*
+*	That being said you are NOT free to redistribute / repack this into
+*	your own mod.
+*
+*/
+
+class EventCronEntry: Managed
+{
+	int ID;
+	typename EventType;
+	ref CronExpression Expression;
+
+	// turned into a fresh Param every time the event starts, events take ownership of their start params
+	ref SerializableParam StartParams;
+
+	// server local time
+	DateTime NextFire;
+
+	void EventCronEntry(int id, typename event_type, CronExpression expression, SerializableParam start_params)
+	{
+		ID = id;
+		EventType = event_type;
+		Expression = expression;
+		StartParams = start_params;
+	}
+}
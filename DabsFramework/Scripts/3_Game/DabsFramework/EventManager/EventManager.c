@@ -24,7 +24,69 @@ class EventManager
 	protected ref map<typename, ref EventMap> m_ActiveEvents = new map<typename, ref EventMap>();
 	protected ref map<typename, int> m_AmountOfEventsRan = new map<typename, int>(); // amount of event type ran
 	protected ref map<typename, float> m_PossibleEventTypes = new map<typename, float>();
-	protected ref map<typename, float> m_EventCooldowns = new map<typename, float>();
+	protected ref EventCooldownTracker m_EventCooldowns = new EventCooldownTracker();
+	
+	// rebuilt from m_PossibleEventTypes whenever RegisterEvent changes it
+	protected ref AliasTable<typename> m_EventSelectionTable = new AliasTable<typename>();
+	
+	// incremental bookkeeping so StartEvent doesnt have to walk m_ActiveEvents
+	protected int m_ActiveEventCount;
+	protected ref map<typename, int> m_EventTypeIndices = new map<typename, int>(); // compact index of every type registered or started
+	protected ref array<typename> m_EventTypes = {};
+	protected ref array<int> m_ActiveTypeCounts = {}; // active events, per type index
+	protected ref BitArray m_ActiveTypeMask = new BitArray(); // set for every type index with an active event
+	protected ref array<ref BitArray> m_ConflictMasks = {}; // built once per type from GetDisallowedEvents()
+	
+	// type -> every active event of that type or inheriting from it, m_InheritedEvents[EventBase] holds all of them
+	protected ref map<typename, ref array<EventBase>> m_InheritedEvents = new map<typename, ref array<EventBase>>();
+	
+	// integer ids for everything the event RPCs would otherwise send as strings
+	protected ref EventRpcRegistry m_RpcRegistry = new EventRpcRegistry();
+	
+	// every event rpc is built in one of these, see AcquireRPC
+	protected ref ScriptRPCPool m_RpcPool = new ScriptRPCPool(32);
+	
+	// Server: bumped every time event state is broadcast to all clients
+	// Client: the generation of the last snapshot / update received
+	protected int m_SnapshotGeneration;
+	protected ref map<string, int> m_ClientSnapshotGenerations = new map<string, int>(); // last generation each client reported holding
+	
+	// rpc type -> events that subscribed to it through EventBase::GetRPCSubscriptions
+	protected ref map<int, ref array<EventBase>> m_RpcRoutes = new map<int, ref array<EventBase>>();
+	
+	// Server: selection, admission, phase timing and rpc counters, flushed to EventMetricsLog
+	static const float METRICS_FLUSH_INTERVAL = 300.0;
+	protected ref EventMetrics m_Metrics = new EventMetrics();
+	protected ref EventMetricsTask m_MetricsTask;
+	
+	// Server: written to $profile whenever an event changes phase, restored by Run
+	protected bool m_CheckpointEnabled;
+	protected bool m_CheckpointDirty;
+	
+	// Server: resolves overlapping WeatherEvent requests, flushed to the weather once per frame
+	protected ref EventWeatherArbiter m_WeatherArbiter = new EventWeatherArbiter();
+	
+	// Server: wall-clock scheduled events, sorted on NextFire. m_CronTask wakes up when the first one is due
+	protected ref array<ref EventCronEntry> m_CronQueue = {};
+	protected ref EventCronTask m_CronTask;
+	protected int m_NextCronId;
+	
+	// TickCount runs at 100ns
+	static const float TICKS_PER_MILLISECOND = 10000.0;
+	
+	// Server: optional per-frame budget for EventBase::UpdateServer, see SetServerUpdateBudget
+	protected float m_ServerUpdateBudget;
+	protected int m_FrameUpdateTicks;
+	protected ref array<EventBase> m_DeferredUpdates = {}; // sorted on GetServerUpdatePriority, highest first
+	
+	// drives the update loops and phase countdowns of every active event
+	protected ref EventScheduler m_Scheduler = new EventScheduler();
+	
+	// Server: events with a EventBase::GetRelevancyArea, these are only synced to the players inside it
+	static const float RELEVANCY_UPDATE_INTERVAL = 1.0;
+	protected ref array<EventBase> m_LocalizedEvents = {};
+	protected ref EventRelevancyTask m_RelevancyTask;
+	protected ref array<Man> m_RelevancyPlayers = {}; // re-used by every relevancy check
 		
 	// deprecated
 	static EventManager Start()
@@ -45,6 +107,9 @@ class EventManager
 	void EventManager()
 	{		
 		DayZGame.Event_OnRPC.Insert(OnRPC);
+		m_RelevancyTask = new EventRelevancyTask(this);
+		m_MetricsTask = new EventMetricsTask(this, METRICS_FLUSH_INTERVAL);
+		m_CronTask = new EventCronTask(this);
 	}
 	
 	void ~EventManager()
@@ -65,41 +130,55 @@ class EventManager
 		m_MaxEventCount = max_event_count;
 		m_EventFreqMin = min_between_events;
 		m_EventFreqMax = max_between_events;
+		
+		if (GetGame().IsServer()) {
+			RestoreCheckpoint();
+			m_CheckpointEnabled = true;
+			MarkCheckpointDirty();
+			
+			if (!m_MetricsTask.IsScheduled()) {
+				m_Scheduler.Schedule(m_MetricsTask, METRICS_FLUSH_INTERVAL);
+			}
+		}
 				
 		// Immediately set the value to avoid an event running before players join
 		m_NextEventIn = Math.RandomFloat(m_EventFreqMin, m_EventFreqMax);
 		EventManagerLog.Info(this, "Next selection will occur in %1 seconds", m_NextEventIn.ToString());
 		EventManagerLog.Info(this, "EventManager is now running");
-		
-		GetGame().GetUpdateQueue(CALL_CATEGORY_SYSTEM).Remove(OnUpdate);
-		GetGame().GetUpdateQueue(CALL_CATEGORY_SYSTEM).Insert(OnUpdate);
 	}
 	
+	// Called every frame by DayZGame, on both client and server
 	void OnUpdate(float dt)
 	{
+		// updates that didnt fit into the last frame go first
+		m_FrameUpdateTicks = 0;
+		RunDeferredUpdates();
+		
+		// runs all event updates that are due, this needs to happen on clients too
+		m_Scheduler.Update(dt);
+		
+		// every weather request made by events this frame
+		m_WeatherArbiter.Flush();
+		
+		// coalesced, so several phase changes in one frame only write the file once
+		if (m_CheckpointDirty) {
+			WriteCheckpoint();
+		}
+		
 		// Not initialized, dont run
 		if (m_MaxEventCount == 0 || m_PossibleEventTypes.Count() == 0) {
 			return;
 		}
 		
-		foreach (typename event_type, float event_cooldown: m_EventCooldowns) {
-			m_EventCooldowns[event_type] = m_EventCooldowns[event_type] - dt;
-			if (m_EventCooldowns[event_type] <= 0) {
-				m_EventCooldowns.Remove(event_type);
-			}
-		}
+		m_EventCooldowns.Update(GetTime());
 		
 		m_NextEventIn -= dt;
 		if (m_NextEventIn <= 0) {
 			EventManagerLog.Info(this, "Trying to select a new event...");												
-			// Just a quick check to make sure we dont run the same event twice
-			typename current_type = GetRandomEvent();
-			while (current_type == m_LastEventType && m_PossibleEventTypes.Count() > 1) {
-				EventManagerLog.Debug(this, "Random event selected was the same as last %1", current_type.ToString());
-				current_type = GetRandomEvent();
-			}
-			
+			// Make sure we dont run the same event twice
+			typename current_type = GetRandomEvent(true);
 			m_LastEventType = current_type;
+			m_Metrics.OnSelected(current_type);
 			
 			//! Start new event
 			StartEvent(current_type);
@@ -113,7 +192,20 @@ class EventManager
 	void RegisterEvent(typename event_type, float frequency = 1.0)
 	{
 		EventManagerLog.Debug(this, "RegisterEvent: %1, freq: %2", event_type.ToString(), frequency.ToString());
+		if (!GetConflictMask(event_type)) {
+			// throwaway instance, GetDisallowedEvents isnt static
+			EventBase event_base = SpawnEvent(event_type);
+			if (event_base) {
+				BuildConflictMask(event_type, event_base);
+			}
+		}
+		
+		if (m_PossibleEventTypes.Contains(event_type) && m_PossibleEventTypes[event_type] == frequency) {
+			return;
+		}
+		
 		m_PossibleEventTypes[event_type] = frequency;
+		m_EventSelectionTable.Build(m_PossibleEventTypes);
 	}
 	
 	// startup_params are passed to OnStart of the event
@@ -125,33 +217,23 @@ class EventManager
 			return null;
 		}
 		
-		// register the map associated with this event type, probably the first time running an event like this
-		if (!m_ActiveEvents[event_type]) {
-			m_ActiveEvents[event_type] = new EventMap();
-		}
-		
-		int active_event_count;
-		foreach (typename type, EventMap events: m_ActiveEvents) {
-			if (!events) {
-				continue;
-			}
-			
-			active_event_count += events.Count();
-		}
-		
-		if (active_event_count >= m_MaxEventCount && !force) {
+		if (m_ActiveEventCount >= m_MaxEventCount && !force) {
 			EventManagerLog.Info(this, "Could not start event as we reached the maximum event limit %1", m_MaxEventCount.ToString());
+			m_Metrics.OnRejected(event_type, EventRejectReason.MAX_EVENTS);
 			return null;
 		}
 		
-		if (m_EventCooldowns[event_type] > 0 && !force) {
-			EventManagerLog.Info(this, "Could not start event %1 as it is on cooldown for %2 more seconds", event_type.ToString(), m_EventCooldowns[event_type].ToString());
+		float cooldown_remaining = m_EventCooldowns.GetRemaining(event_type, GetTime());
+		if (cooldown_remaining > 0 && !force) {
+			EventManagerLog.Info(this, "Could not start event %1 as it is on cooldown for %2 more seconds", event_type.ToString(), cooldown_remaining.ToString());
+			m_Metrics.OnRejected(event_type, EventRejectReason.COOLDOWN);
 			return null;
 		}
 						
 		EventBase event_base = SpawnEvent(event_type);
 		if (!event_base) {
 			EventManagerLog.Info(this, "Failed to start event %1", event_type.ToString());
+			m_Metrics.OnRejected(event_type, EventRejectReason.SPAWN_FAILED);
 			return null;
 		}
 		
@@ -160,21 +242,29 @@ class EventManager
 		
 		// event_id is ALWAYS 0 when parallel events are disallowed
 		int event_id = m_AmountOfEventsRan[event_type] * (event_base.MaxEventCount() > 1);
-		if (m_ActiveEvents[event_type].Count() >= event_base.MaxEventCount()) {  // do not put force here, even FORCE wont allow multiple events to be run
+		int event_type_index = GetEventTypeIndex(event_type);
+		if (m_ActiveTypeCounts[event_type_index] >= event_base.MaxEventCount()) {  // do not put force here, even FORCE wont allow multiple events to be run
 			EventManagerLog.Info(this, "Could not start %1 as the max amount of events for this type has been achieved (%2)", event_type.ToString(), event_base.MaxEventCount().ToString());
+			m_Metrics.OnRejected(event_type, EventRejectReason.MAX_TYPE_COUNT);
 			return null;
 		}
 						
-		// check for disallowed evemts		
-		foreach (typename etype, EventMap ebase: m_ActiveEvents) {
-			if (event_base.GetDisallowedEvents().Find(etype) != -1 && !force) {
-				EventManagerLog.Info(this, "Could not run event %1 because it conflicts with event %2...", event_type.ToString(), etype.ToString());
-				return null;
-			}
+		// check for disallowed events, only types that were never registered need their mask built here
+		BitArray conflict_mask = GetConflictMask(event_type);
+		if (!conflict_mask) {
+			conflict_mask = BuildConflictMask(event_type, event_base);
+		}
+		
+		if (conflict_mask.Intersects(m_ActiveTypeMask) && !force) {
+			typename conflicting_type = m_EventTypes[conflict_mask.FindFirstIntersection(m_ActiveTypeMask)];
+			EventManagerLog.Info(this, "Could not run event %1 because it conflicts with event %2...", event_type.ToString(), conflicting_type.ToString());
+			m_Metrics.OnRejected(event_type, EventRejectReason.CONFLICT);
+			return null;
 		}
 		
 		if (!event_base.EventActivateCondition() && !force) {
 			EventManagerLog.Info(this, "Could not run %1, failed ActivateCondition", event_type.ToString());
+			m_Metrics.OnRejected(event_type, EventRejectReason.ACTIVATE_CONDITION);
 			return null;
 		}
 		
@@ -182,17 +272,215 @@ class EventManager
 		event_base.SetID(event_id);
 		
 		// assign the event to the map now that we know the id is valid
-		m_ActiveEvents[event_type][event_id] = event_base;
+		InsertActiveEvent(event_type, event_id, event_base);
 		
 		// Register event for cooldown
-		m_EventCooldowns.Insert(event_type, event_base.GetEventCooldown());
+		if (event_base.GetEventCooldown() > 0) {
+			m_EventCooldowns.Start(event_type, GetTime() + event_base.GetEventCooldown());
+		}
 		
 		// start the event
 		EventManagerLog.Info(this, "Starting event %1", event_type.ToString());
+		m_Metrics.OnStarted(event_type);
 		event_base.OnStart(startup_params);
 		return event_base;
 	}
 	
+	/*
+		Limits how long EventBase::UpdateServer calls can take per frame, in milliseconds. 0 (the default) disables it
+		updates that are due once the budget is used up wait for the next frame, highest EventBase::GetServerUpdatePriority first
+		at least one waiting update runs every frame, so a single heavy event is never stuck
+	*/
+	void SetServerUpdateBudget(float milliseconds)
+	{
+		m_ServerUpdateBudget = milliseconds;
+		if (m_ServerUpdateBudget <= 0) {
+			RunDeferredUpdates();
+		}
+	}
+	
+	float GetServerUpdateBudget()
+	{
+		return m_ServerUpdateBudget;
+	}
+	
+	int GetDeferredUpdateCount()
+	{
+		return m_DeferredUpdates.Count();
+	}
+	
+	// Called by EventBase when its server update is due
+	void RequestServerUpdate(notnull EventBase event_base)
+	{
+		if (m_ServerUpdateBudget <= 0) {
+			RunServerUpdate(event_base);
+			return;
+		}
+		
+		// still waiting from an earlier frame, this update is folded into that one
+		if (m_DeferredUpdates.Find(event_base) != -1) {
+			m_Metrics.OnDeferred(event_base.Type());
+			return;
+		}
+		
+		if (m_FrameUpdateTicks >= m_ServerUpdateBudget * TICKS_PER_MILLISECOND) {
+			DeferServerUpdate(event_base);
+			return;
+		}
+		
+		RunServerUpdate(event_base);
+	}
+	
+	protected void RunServerUpdate(EventBase event_base)
+	{
+		// the event is allowed to delete itself while updating
+		typename event_type = event_base.Type();
+		int start_ticks = TickCount(0);
+		event_base.RunServerUpdate();
+		
+		int update_ticks = TickCount(start_ticks);
+		m_FrameUpdateTicks += update_ticks;
+		m_Metrics.OnServerUpdate(event_type, update_ticks / TICKS_PER_MILLISECOND);
+	}
+	
+	protected void DeferServerUpdate(EventBase event_base)
+	{
+		m_Metrics.OnDeferred(event_base.Type());
+		
+		// after every waiting update with the same or a higher priority
+		int priority = event_base.GetServerUpdatePriority();
+		int index = 0;
+		while (index < m_DeferredUpdates.Count() && (!m_DeferredUpdates[index] || m_DeferredUpdates[index].GetServerUpdatePriority() >= priority)) {
+			index++;
+		}
+		
+		m_DeferredUpdates.InsertAt(event_base, index);
+	}
+	
+	protected void RunDeferredUpdates()
+	{
+		bool ran_update;
+		while (m_DeferredUpdates.Count() > 0) {
+			if (ran_update && m_ServerUpdateBudget > 0 && m_FrameUpdateTicks >= m_ServerUpdateBudget * TICKS_PER_MILLISECOND) {
+				return;
+			}
+			
+			EventBase event_base = m_DeferredUpdates[0];
+			m_DeferredUpdates.RemoveOrdered(0);
+			
+			// deleted or paused while waiting
+			if (!event_base || event_base.IsPaused()) {
+				continue;
+			}
+			
+			RunServerUpdate(event_base);
+			ran_update = true;
+		}
+	}
+	
+	/*
+		Starts event_type whenever cron_expression matches the server clock (local time), see CronExpression
+		scheduled starts go through StartEvent like random ones, so the max event count, cooldowns and conflicts still apply
+	
+		m_EventManager.ScheduleEvent(AirdropEvent, "0 * * * *");
+		m_EventManager.ScheduleEvent(NightRaidEvent, "0 21 * * *", SerializableParam1<string>.Create("Elektro"));
+	
+		returns the id to pass to UnscheduleEvent, -1 if the expression is invalid
+	*/
+	int ScheduleEvent(typename event_type, string cron_expression, SerializableParam start_params = null)
+	{
+		if (!GetGame().IsServer()) {
+			EventManagerLog.Info(this, "ScheduleEvent must be called on SERVER, exiting");
+			return -1;
+		}
+		
+		CronExpression expression = CronExpression.Parse(cron_expression);
+		if (!expression) {
+			EventManagerLog.Info(this, "Invalid cron expression '%1' for %2", cron_expression, event_type.ToString());
+			return -1;
+		}
+		
+		EventCronEntry entry = new EventCronEntry(m_NextCronId++, event_type, expression, start_params);
+		entry.NextFire = expression.GetNext(DateTime.Now(false));
+		if (entry.NextFire == DateTime.EPOCH) {
+			EventManagerLog.Info(this, "Cron expression '%1' for %2 never fires", cron_expression, event_type.ToString());
+			return -1;
+		}
+		
+		EventManagerLog.Info(this, "Scheduled %1 at '%2', next start %3", event_type.ToString(), cron_expression, entry.NextFire.ToString(DateTime.FORMAT_ISO_DATETIME));
+		InsertCronEntry(entry);
+		ScheduleCronTask();
+		return entry.ID;
+	}
+	
+	bool UnscheduleEvent(int schedule_id)
+	{
+		for (int i = 0; i < m_CronQueue.Count(); i++) {
+			if (m_CronQueue[i].ID == schedule_id) {
+				m_CronQueue.RemoveOrdered(i);
+				ScheduleCronTask();
+				return true;
+			}
+		}
+		
+		return false;
+	}
+	
+	// Called by m_CronTask, starts everything that is due and goes back to sleep until the next one
+	void RunCronSchedule()
+	{
+		DateTime now = DateTime.Now(false);
+		while (m_CronQueue.Count() > 0 && m_CronQueue[0].NextFire <= now) {
+			EventCronEntry entry = m_CronQueue[0];
+			m_CronQueue.RemoveOrdered(0);
+			
+			Param start_params;
+			if (entry.StartParams) {
+				start_params = entry.StartParams.ToParam();
+			}
+			
+			EventManagerLog.Info(this, "Starting scheduled event %1 (%2)", entry.EventType.ToString(), entry.Expression.GetExpression());
+			StartEvent(entry.EventType, false, start_params);
+			
+			// a clock jump skips the missed runs rather than starting them all at once
+			entry.NextFire = entry.Expression.GetNext(now);
+			if (entry.NextFire != DateTime.EPOCH) {
+				InsertCronEntry(entry);
+			}
+		}
+		
+		ScheduleCronTask();
+	}
+	
+	protected void InsertCronEntry(EventCronEntry entry)
+	{
+		// binary search for the first entry firing after this one, so equal times keep their scheduling order
+		int low = 0;
+		int high = m_CronQueue.Count();
+		while (low < high) {
+			int middle = (low + high) / 2;
+			if (m_CronQueue[middle].NextFire <= entry.NextFire) {
+				low = middle + 1;
+			} else {
+				high = middle;
+			}
+		}
+		
+		m_CronQueue.InsertAt(entry, low);
+	}
+	
+	protected void ScheduleCronTask()
+	{
+		if (m_CronQueue.Count() == 0) {
+			m_Scheduler.Cancel(m_CronTask);
+			return;
+		}
+		
+		// the wall clock and the scheduler can drift apart, RunCronSchedule re-checks the clock and sleeps again if woken early
+		float delay = m_CronQueue[0].NextFire - DateTime.Now(false);
+		m_Scheduler.Schedule(m_CronTask, Math.Max(delay, 1));
+	}
+	
 	bool CancelEvent(EventBase event_base)
 	{
 		if (!GetGame().IsServer()) {
@@ -208,9 +496,7 @@ class EventManager
 	void DeleteEvent(EventBase event_base)
 	{
 		EventManagerLog.Debug(this, "Deleting %1, idx: %2", event_base.Type().ToString(), event_base.GetID().ToString());
-		if (m_ActiveEvents && m_ActiveEvents[event_base.Type()]) {
-			m_ActiveEvents[event_base.Type()].Remove(event_base.GetID());
-		}
+		RemoveActiveEvent(event_base);
 	}
 	
 	// you only need to worry about event_id if you allow parralel events
@@ -234,83 +520,51 @@ class EventManager
 	void OnRPC(PlayerIdentity sender, Object target, int rpc_type, ParamsReadContext ctx)
 	{	
 		switch (rpc_type) {			
+			case ERPCsDabsFramework.EVENT_REGISTRY: {
+				if (GetGame().IsDedicatedServer()) {
+					break;
+				}
+				
+				m_RpcRegistry.Read(ctx);
+				break;
+			}
+			
 			case ERPCsDabsFramework.EVENT_UPDATE: {								
 				if (GetGame().IsClient() || !GetGame().IsMultiplayer()) {
-					string str_event_type;
-					if (!ctx.Read(str_event_type)) {
-						Print(str_event_type);
-						break;
-					}
-					
-					typename event_type = str_event_type.ToType();
-					int event_id;
-					if (!ctx.Read(event_id)) {
-						break;
-					}
-
-					int event_phase;
-					if (!ctx.Read(event_phase)) {
+					int update_generation;
+					if (!ctx.Read(update_generation)) {
 						break;
 					}
 					
-					float event_phase_time;
-					if (!ctx.Read(event_phase_time)) {
-						break;
-					}
-					
-					bool event_paused;
-					if (!ctx.Read(event_paused)) {
-						break;
+					if (ReadEventState(ctx)) {
+						m_SnapshotGeneration = update_generation;
 					}
-					
-					// Set up serialized data
-					// this parameter can be null so we check if the ctx reads it successfully
-					string event_param_type;
-					if (!ctx.Read(event_param_type)) {
-						break;
-					}
-					
-					Param client_param;
-					if (event_param_type != "null") {
-						SerializableParam serializeable_param = SerializableParam.Cast(event_param_type.ToType().Spawn());
-						serializeable_param.Read(ctx);
-						client_param = serializeable_param.ToParam();
-					}
-					
-					EventManagerLog.Info(this, "Client received event manager update %1: %2", str_event_type, event_phase.ToString());										
-										
-					if (!m_ActiveEvents[event_type]) {
-						m_ActiveEvents[event_type] = new EventMap();
-					}
-					
-					// Case for JIP players	
-					if (!m_ActiveEvents[event_type][event_id]) {
-						m_ActiveEvents[event_type][event_id] = SpawnEvent(event_type);
-						if (!m_ActiveEvents[event_type][event_id]) return;
-					}						
-					
-					// Event finished
-					if (event_phase == EventPhase.DELETE) {
-						DeleteEvent(m_ActiveEvents[event_type][event_id]);
-						break;
-					}
-					
-					// Play catch-up to the current phase
-					if (m_ActiveEvents[event_type][event_id].JIPRunPreviousPhases()) {
-						for (int i = m_ActiveEvents[event_type][event_id].GetCurrentPhase(); i < event_phase; i++) {
-							m_ActiveEvents[event_type][event_id].SwitchPhase(i);
-						}					
-					}
-					
-					m_ActiveEvents[event_type][event_id].SwitchPhase(event_phase, event_phase_time, client_param);
-					
-					// Forced setting for clients since this needs to be controlled separately
-					// the client does not have authority to pause events directly, but we do
-					EnScript.SetClassVar(m_ActiveEvents[event_type][event_id], "m_IsPaused", 0, event_paused);
 				}
 				
 				break;
-			}				
+			}
+			
+			case ERPCsDabsFramework.EVENT_SNAPSHOT: {
+				if (GetGame().IsClient() || !GetGame().IsMultiplayer()) {
+					ReadSnapshot(ctx);
+				}
+				
+				break;
+			}
+			
+			case ERPCsDabsFramework.EVENT_SNAPSHOT_ACK: {
+				if (GetGame().IsClient() || !sender) {
+					break;
+				}
+				
+				int acknowledged_generation;
+				if (!ctx.Read(acknowledged_generation)) {
+					break;
+				}
+				
+				m_ClientSnapshotGenerations[sender.GetId()] = acknowledged_generation;
+				break;
+			}
 			
 			case ERPCsDabsFramework.EVENT_FUNCTION: {
 				if (GetGame().IsDedicatedServer()) {
@@ -318,12 +572,12 @@ class EventManager
 				}
 				
 				// the variable naming sucks bc this enf sucks
-				string str_event_type_fnc;
-				if (!ctx.Read(str_event_type_fnc)) {
+				int event_type_id_fnc;
+				if (!ctx.Read(event_type_id_fnc)) {
 					break;
 				}
 				
-				typename event_type_fnc = str_event_type_fnc.ToType();
+				typename event_type_fnc = m_RpcRegistry.GetEventType(event_type_id_fnc);
 				int event_id_fnc;
 				if (!ctx.Read(event_id_fnc)) {
 					break;
@@ -334,20 +588,20 @@ class EventManager
 					break; // failed
 				}
 				
-				string event_fnc_name;
-				if (!ctx.Read(event_fnc_name)) {
+				int event_fnc_id;
+				if (!ctx.Read(event_fnc_id)) {
 					break;
 				}
 				
-				string event_param_type_fnc;
-				if (!ctx.Read(event_param_type_fnc)) {
+				string event_fnc_name = m_RpcRegistry.GetFunctionName(event_fnc_id);
+				if (event_fnc_name == string.Empty) {
+					EventManagerLog.Info(this, "Unknown client function id %1", event_fnc_id.ToString());
 					break;
 				}
 				
 				SerializableParam client_fnc_param;
-				if (event_param_type_fnc != "null") {
-					client_fnc_param = SerializableParam.Cast(event_param_type_fnc.ToType().Spawn());
-					client_fnc_param.Read(ctx);
+				if (!m_RpcRegistry.ReadParam(ctx, client_fnc_param)) {
+					break;
 				}
 				
 				g_Script.CallFunctionParams(m_ActiveEvents[event_type_fnc][event_id_fnc], event_fnc_name, null, client_fnc_param);				
@@ -355,12 +609,51 @@ class EventManager
 			}
 		}
 		
-		foreach (typename et, EventMap event_base_map: m_ActiveEvents) {
-			foreach (int id, EventBase event_base: event_base_map) {
-				if (event_base) {
-					event_base.OnRPC(sender, target, rpc_type, ctx);
-				}
+		// only events that subscribed to this rpc (or to all of them) get it
+		RouteRPC(rpc_type, sender, target, rpc_type, ctx);
+		RouteRPC(EventBase.RPC_ALL, sender, target, rpc_type, ctx);
+	}
+	
+	protected void RouteRPC(int route, PlayerIdentity sender, Object target, int rpc_type, ParamsReadContext ctx)
+	{
+		array<EventBase> route_events = m_RpcRoutes[route];
+		if (!route_events || route_events.Count() == 0) {
+			return;
+		}
+		
+		// copied, OnRPC is free to start or cancel events
+		array<EventBase> recipients = {};
+		recipients.Copy(route_events);
+		foreach (EventBase recipient: recipients) {
+			if (recipient) {
+				recipient.OnRPC(sender, target, rpc_type, ctx);
+			}
+		}
+	}
+	
+	protected void SubscribeRPCs(EventBase event_base)
+	{
+		TIntArray rpc_types = event_base.GetRPCSubscriptions();
+		if (!rpc_types) {
+			return;
+		}
+		
+		foreach (int rpc_type: rpc_types) {
+			if (!m_RpcRoutes[rpc_type]) {
+				m_RpcRoutes[rpc_type] = new array<EventBase>();
 			}
+			
+			if (m_RpcRoutes[rpc_type].Find(event_base) == -1) {
+				m_RpcRoutes[rpc_type].Insert(event_base);
+			}
+		}
+	}
+	
+	// walks the routes instead of asking the event, this runs while the event is being destroyed
+	protected void UnsubscribeRPCs(EventBase event_base)
+	{
+		foreach (int rpc_type, array<EventBase> route_events: m_RpcRoutes) {
+			route_events.RemoveItem(event_base);
 		}
 	}
 	
@@ -372,37 +665,452 @@ class EventManager
 			return false;
 		}
 		
-		ScriptRPC rpc = new ScriptRPC();
-		rpc.Write(target.Type().ToString());
+		ScriptRPC rpc = AcquireRPC();
+		rpc.Write(m_RpcRegistry.GetEventTypeId(target.Type()));
 		rpc.Write(target.GetID());
-		rpc.Write(function_name);	
+		rpc.Write(m_RpcRegistry.GetFunctionId(function_name));	
 		
 		// handle data
-		if (params) {
-			rpc.Write(params.GetSerializeableType());
-			params.Write(rpc);
-		} else {
-			rpc.Write("null");
+		int size = 12 + m_RpcRegistry.WriteParam(rpc, params);
+		SendEventRPC(target, rpc, ERPCsDabsFramework.EVENT_FUNCTION, identity, size);
+		ReleaseRPC(rpc);
+		return true;
+	}
+	
+	// Sends rpc to identity, or to every client that should know about event_base when identity is null
+	// size: estimated bytes written to rpc, for metrics only
+	void SendEventRPC(EventBase event_base, ScriptRPC rpc, int rpc_type, PlayerIdentity identity, int size = 0)
+	{
+		PositionWithRadius2D area;
+		if (!identity && GetGame().IsMultiplayer()) {
+			area = event_base.GetRelevancyArea();
 		}
 		
-		rpc.Send(null, ERPCsDabsFramework.EVENT_FUNCTION, true, identity);
-		return true;
+		if (!area) {
+			SendRPC(rpc, rpc_type, identity, event_base, size);
+			return;
+		}
+		
+		// first broadcast of a localized event, start tracking which players are near it
+		if (m_LocalizedEvents.Find(event_base) == -1) {
+			m_LocalizedEvents.Insert(event_base);
+			if (!m_RelevancyTask.IsScheduled()) {
+				m_Scheduler.Schedule(m_RelevancyTask, RELEVANCY_UPDATE_INTERVAL);
+			}
+		}
+		
+		// players that walked in since the last check receive state updates with this rpc
+		// anything else needs the event to exist on their client first, so they get a catch-up sync before it
+		m_RelevancyPlayers.Clear();
+		GetGame().GetPlayers(m_RelevancyPlayers);
+		UpdateEventRelevancy(event_base, m_RelevancyPlayers, rpc_type != ERPCsDabsFramework.EVENT_UPDATE);
+		
+		set<string> relevant_clients = event_base.GetRelevantClients();
+		foreach (Man player: m_RelevancyPlayers) {
+			if (!player || !player.GetIdentity()) {
+				continue;
+			}
+			
+			if (relevant_clients.Find(player.GetIdentity().GetId()) != -1) {
+				SendRPC(rpc, rpc_type, player.GetIdentity(), event_base, size);
+			}
+		}
+	}
+	
+	// rpcs are reused, release them once they were sent
+	ScriptRPC AcquireRPC()
+	{
+		return m_RpcPool.Acquire();
+	}
+	
+	void ReleaseRPC(ScriptRPC rpc)
+	{
+		m_RpcPool.Release(rpc);
+	}
+	
+	// every event rpc goes out through here, event_base is the event it belongs to (if any)
+	protected void SendRPC(ScriptRPC rpc, int rpc_type, PlayerIdentity identity, EventBase event_base = null, int size = 0)
+	{
+		if (event_base) {
+			m_Metrics.OnRpc(event_base.Type(), size);
+		}
+		
+		rpc.Send(null, rpc_type, true, identity);
+	}
+	
+	// Called by m_RelevancyTask, syncs localized events to players that entered their area and removes them from players that left
+	void UpdateRelevancy()
+	{
+		if (m_LocalizedEvents.Count() == 0) {
+			return;
+		}
+		
+		m_RelevancyPlayers.Clear();
+		GetGame().GetPlayers(m_RelevancyPlayers);
+		foreach (EventBase event_base: m_LocalizedEvents) {
+			if (event_base) {
+				UpdateEventRelevancy(event_base, m_RelevancyPlayers, true);
+			}
+		}
+		
+		m_Scheduler.Schedule(m_RelevancyTask, RELEVANCY_UPDATE_INTERVAL);
+	}
+	
+	// catch_up: sync the full event state to players that just entered the area
+	protected void UpdateEventRelevancy(EventBase event_base, array<Man> players, bool catch_up)
+	{
+		PositionWithRadius2D area = event_base.GetRelevancyArea();
+		if (!area) {
+			return;
+		}
+		
+		set<string> relevant_clients = event_base.GetRelevantClients();
+		float exit_radius = area.Radius + event_base.GetRelevancyMargin();
+		foreach (Man player: players) {
+			if (!player || !player.GetIdentity()) {
+				continue;
+			}
+			
+			PlayerIdentity identity = player.GetIdentity();
+			float distance = GetDistance2D(area.Position, player.GetPosition());
+			int index = relevant_clients.Find(identity.GetId());
+			if (index == -1 && distance <= area.Radius) {
+				relevant_clients.Insert(identity.GetId());
+				if (catch_up) {
+					event_base.SyncToClient(identity);
+				}
+			} else if (index != -1 && distance > exit_radius) {
+				relevant_clients.Remove(index);
+				SendEventRemoved(event_base, identity);
+			}
+		}
+	}
+	
+	// tells a client that left the area to delete its copy of the event
+	protected void SendEventRemoved(EventBase event_base, PlayerIdentity identity)
+	{
+		EventManagerLog.Debug(this, "%1 left the area of %2", identity.GetId(), event_base.ToString());
+		ScriptRPC rpc = AcquireRPC();
+		rpc.Write(m_SnapshotGeneration);
+		int size = 4 + event_base.WriteState(rpc, EventPhase.DELETE);
+		SendRPC(rpc, ERPCsDabsFramework.EVENT_UPDATE, identity, event_base, size);
+		ReleaseRPC(rpc);
+	}
+	
+	// always true for global events, and when offline
+	protected bool IsInRelevancyArea(EventBase event_base, Man player)
+	{
+		if (!GetGame().IsMultiplayer()) {
+			return true;
+		}
+		
+		PositionWithRadius2D area = event_base.GetRelevancyArea();
+		if (!area) {
+			return true;
+		}
+		
+		return GetDistance2D(area.Position, player.GetPosition()) <= area.Radius;
+	}
+	
+	protected float GetDistance2D(vector a, vector b)
+	{
+		return vector.Distance(Vector(a[0], 0, a[2]), Vector(b[0], 0, b[2]));
 	}
 		
+	// Sends every active event to a joining player as a single snapshot
+	// skipped entirely when the client reported it already holds the current generation (respawns, repeated connects)
 	void DispatchEventInfo(Man player)
 	{
+		PlayerIdentity identity = player.GetIdentity();
+		if (identity && m_ClientSnapshotGenerations.Contains(identity.GetId()) && m_ClientSnapshotGenerations[identity.GetId()] == m_SnapshotGeneration) {
+			EventManagerLog.Debug(this, "%1 already holds snapshot generation %2", player.ToString(), m_SnapshotGeneration.ToString());
+			return;
+		}
+		
 		EventManagerLog.Debug(this, "Sending In Progress info to %1", player.ToString());
+		
+		// build first, any ids created while writing are broadcast before the table is sent
+		ScriptRPC rpc = AcquireRPC();
+		WriteSnapshot(rpc, player);
+		
+		// the client needs the id tables before it can read any event data
+		m_RpcRegistry.SendTo(identity);
+		SendRPC(rpc, ERPCsDabsFramework.EVENT_SNAPSHOT, identity);
+		ReleaseRPC(rpc);
+	}
+	
+	void OnClientDisconnected(PlayerIdentity identity)
+	{
+		if (!identity) {
+			return;
+		}
+		
+		m_ClientSnapshotGenerations.Remove(identity.GetId());
+		
+		// they get a fresh snapshot of whatever is near them when they come back
+		foreach (EventBase event_base: m_LocalizedEvents) {
+			if (!event_base) {
+				continue;
+			}
+			
+			int index = event_base.GetRelevantClients().Find(identity.GetId());
+			if (index != -1) {
+				event_base.GetRelevantClients().Remove(index);
+			}
+		}
+	}
+	
+	int GetSnapshotGeneration()
+	{
+		return m_SnapshotGeneration;
+	}
+	
+	// Server: called whenever event state is broadcast to every client
+	int AdvanceSnapshotGeneration()
+	{
+		m_SnapshotGeneration++;
+		
+		// guaranteed RPCs arrive in order, so anyone that was up to date still is after this broadcast
+		foreach (string identity_id, int generation: m_ClientSnapshotGenerations) {
+			if (generation == m_SnapshotGeneration - 1) {
+				m_ClientSnapshotGenerations[identity_id] = m_SnapshotGeneration;
+			}
+		}
+		
+		return m_SnapshotGeneration;
+	}
+	
+	// localized events are only included when player is inside their area
+	protected void WriteSnapshot(Serializer ctx, Man player)
+	{
+		int count;
+		foreach (typename count_type, EventMap count_map: m_ActiveEvents) {
+			foreach (int count_id, EventBase count_event: count_map) {
+				if (count_event && IsInRelevancyArea(count_event, player)) {
+					count++;
+				}
+			}
+		}
+		
+		ctx.Write(m_SnapshotGeneration);
+		ctx.Write(count);
 		foreach (typename event_type, EventMap event_map: m_ActiveEvents) {
 			foreach (int event_id, EventBase event_base: event_map) {
-				if (!event_base) {
+				if (!event_base || !IsInRelevancyArea(event_base, player)) {
 					continue;
 				}
 				
-				event_base.SyncToClient(player.GetIdentity());
+				event_base.WriteState(ctx);
+				
+				// already has it, the relevancy check shouldnt send it again
+				if (event_base.GetRelevancyArea() && player.GetIdentity() && event_base.GetRelevantClients().Find(player.GetIdentity().GetId()) == -1) {
+					event_base.GetRelevantClients().Insert(player.GetIdentity().GetId());
+				}
 			}
 		}
 	}
+	
+	protected bool ReadSnapshot(ParamsReadContext ctx)
+	{
+		int generation, count;
+		if (!ctx.Read(generation) || !ctx.Read(count)) {
+			return false;
+		}
+		
+		EventManagerLog.Info(this, "Client received event snapshot %1 with %2 events", generation.ToString(), count.ToString());
+		for (int i = 0; i < count; i++) {
+			if (!ReadEventState(ctx)) {
+				return false;
+			}
+		}
+		
+		m_SnapshotGeneration = generation;
+		
+		// let the server know it doesnt have to send this again
+		if (GetGame().IsMultiplayer()) {
+			ScriptRPC rpc = AcquireRPC();
+			rpc.Write(m_SnapshotGeneration);
+			SendRPC(rpc, ERPCsDabsFramework.EVENT_SNAPSHOT_ACK, null);
+			ReleaseRPC(rpc);
+		}
+		
+		return true;
+	}
+	
+	// Reads and applies one event written by EventBase::WriteState
+	// returns false when the ctx could not be read, anything after it cant be trusted
+	protected bool ReadEventState(ParamsReadContext ctx)
+	{
+		int event_type_id;
+		if (!ctx.Read(event_type_id)) {
+			return false;
+		}
+		
+		int event_id;
+		if (!ctx.Read(event_id)) {
+			return false;
+		}
+
+		int event_phase;
+		if (!ctx.Read(event_phase)) {
+			return false;
+		}
+		
+		float event_phase_time;
+		if (!ctx.Read(event_phase_time)) {
+			return false;
+		}
+		
+		bool event_paused;
+		if (!ctx.Read(event_paused)) {
+			return false;
+		}
+		
+		// Set up serialized data
+		// this parameter can be null so we check if the ctx reads it successfully
+		SerializableParam serializeable_param;
+		if (!m_RpcRegistry.ReadParam(ctx, serializeable_param)) {
+			return false;
+		}
+		
+		typename event_type = m_RpcRegistry.GetEventType(event_type_id);
+		if (!event_type) {
+			EventManagerLog.Info(this, "Received update for unknown event type id %1", event_type_id.ToString());
+			return true;
+		}
+		
+		Param client_param;
+		if (serializeable_param) {
+			client_param = serializeable_param.ToParam();
+		}
+		
+		EventManagerLog.Info(this, "Client received event manager update %1: %2", event_type.ToString(), event_phase.ToString());										
+							
+		// Case for JIP players	
+		EventBase event_base = GetEvent(event_type, event_id);
+		if (!event_base) {
+			// removal of an event this client never had, happens when leaving the area of a localized event
+			if (event_phase == EventPhase.DELETE) {
+				return true;
+			}
+			
+			event_base = SpawnEvent(event_type);
+			if (!event_base) {
+				return true;
+			}
+			
+			event_base.SetID(event_id);
+			InsertActiveEvent(event_type, event_id, event_base);
+		}						
+		
+		// Event finished
+		if (event_phase == EventPhase.DELETE) {
+			DeleteEvent(event_base);
+			return true;
+		}
+		
+		// Play catch-up to the current phase
+		if (event_base.JIPRunPreviousPhases()) {
+			for (int i = event_base.GetCurrentPhase(); i < event_phase; i++) {
+				event_base.SwitchPhase(i);
+			}					
+		}
+		
+		event_base.SwitchPhase(event_phase, event_phase_time, client_param);
+		
+		// Rebuild the phase deadline and pause state from what the server sent, offline the server already owns it
+		if (event_base && !GetGame().IsServer()) {
+			event_base.OnServerSync(event_phase_time, event_paused);
+		}
+		
+		return true;
+	}
+	
+	// the checkpoint is written on the next update, does nothing before Run is called
+	void MarkCheckpointDirty()
+	{
+		m_CheckpointDirty = m_CheckpointEnabled;
+	}
+	
+	protected void WriteCheckpoint()
+	{
+		m_CheckpointDirty = false;
+		
+		EventCheckpoint checkpoint = new EventCheckpoint();
+		checkpoint.RunCounts.Copy(m_AmountOfEventsRan);
+		checkpoint.Cooldowns.Copy(m_EventCooldowns.GetCooldowns(GetTime()));
+		foreach (typename event_type, EventMap event_map: m_ActiveEvents) {
+			foreach (int event_id, EventBase event_base: event_map) {
+				// not started yet, or on its way out
+				if (!event_base || event_base.GetCurrentPhase() <= EventPhase.INVALID || event_base.GetCurrentPhase() >= EventPhase.DELETE) {
+					continue;
+				}
 				
+				EventCheckpointEntry entry = new EventCheckpointEntry();
+				entry.EventType = event_type;
+				entry.ID = event_id;
+				entry.Phase = event_base.GetCurrentPhase();
+				entry.TimeRemaining = event_base.GetCurrentPhaseTimeRemaining();
+				entry.Paused = event_base.IsPaused();
+				entry.StartParams = event_base.GetCheckpointParams();
+				checkpoint.Events.Insert(entry);
+			}
+		}
+		
+		if (!checkpoint.Save()) {
+			EventManagerLog.Info(this, "Failed to write event checkpoint %1", EventCheckpoint.FILE_NAME);
+		}
+	}
+	
+	protected void RestoreCheckpoint()
+	{
+		EventCheckpoint checkpoint = EventCheckpoint.Load();
+		if (!checkpoint) {
+			return;
+		}
+		
+		EventManagerLog.Info(this, "Restoring event checkpoint with %1 events", checkpoint.Events.Count().ToString());
+		m_AmountOfEventsRan.Copy(checkpoint.RunCounts);
+		foreach (typename cooldown_type, float cooldown: checkpoint.Cooldowns) {
+			m_EventCooldowns.Start(cooldown_type, GetTime() + cooldown);
+		}
+		
+		foreach (EventCheckpointEntry entry: checkpoint.Events) {
+			if (!entry.EventType || IsEventActive(entry.EventType, entry.ID)) {
+				continue;
+			}
+			
+			EventBase event_base = SpawnEvent(entry.EventType);
+			if (!event_base) {
+				continue;
+			}
+			
+			event_base.SetID(entry.ID);
+			
+			Param start_params;
+			if (entry.StartParams) {
+				start_params = entry.StartParams.ToParam();
+			}
+			
+			// never started in this session, so it doesnt go through the phases (no OnEventEndServer, no DELETE sync)
+			if (!event_base.CanResume()) {
+				EventManagerLog.Info(this, "Discarding %1 from checkpoint, it cannot be resumed", entry.EventType.ToString());
+				event_base.OnDiscardCheckpoint(entry.Phase, start_params);
+				delete event_base;
+				continue;
+			}
+			
+			InsertActiveEvent(entry.EventType, entry.ID, event_base);
+			EventManagerLog.Info(this, "Resuming %1 in phase %2 with %3 seconds remaining", entry.EventType.ToString(), typename.EnumToString(EventPhase, entry.Phase), entry.TimeRemaining.ToString());
+			event_base.OnResume(entry.Phase, entry.TimeRemaining, entry.Paused, start_params);
+		}
+	}
+	
+	int GetActiveEventCount()
+	{
+		return m_ActiveEventCount;
+	}
+	
 	bool IsEventActive(typename event_type)
 	{
 		return (m_ActiveEvents[event_type] && m_ActiveEvents[event_type].Count() > 0);
@@ -413,6 +1121,152 @@ class EventManager
 		return (m_ActiveEvents[event_type] && m_ActiveEvents[event_type][event_id]);
 	}
 	
+	// snapshot of every event type on cooldown, with the seconds remaining on each
+	map<typename, float> GetCooldowns()
+	{
+		return m_EventCooldowns.GetCooldowns(GetTime());
+	}
+	
+	float GetCooldownRemaining(typename event_type)
+	{
+		return m_EventCooldowns.GetRemaining(event_type, GetTime());
+	}
+	
+	EventWeatherArbiter GetWeatherArbiter()
+	{
+		return m_WeatherArbiter;
+	}
+	
+	EventMetrics GetMetrics()
+	{
+		return m_Metrics;
+	}
+	
+	// Called by m_MetricsTask
+	void FlushMetrics()
+	{
+		m_Metrics.Flush(GetTime());
+	}
+	
+	EventRpcRegistry GetRpcRegistry()
+	{
+		return m_RpcRegistry;
+	}
+	
+	EventScheduler GetScheduler()
+	{
+		return m_Scheduler;
+	}
+	
+	// seconds since the EventManager was created, all event deadlines are measured against this
+	float GetTime()
+	{
+		return m_Scheduler.GetTime();
+	}
+	
+	protected void InsertActiveEvent(typename event_type, int event_id, EventBase event_base)
+	{
+		// register the map associated with this event type, probably the first time running an event like this
+		if (!m_ActiveEvents[event_type]) {
+			m_ActiveEvents[event_type] = new EventMap();
+		}
+		
+		m_ActiveEvents[event_type][event_id] = event_base;
+		m_ActiveEventCount++;
+		SubscribeRPCs(event_base);
+		
+		for (typename inherited_type = event_type; inherited_type && inherited_type.IsInherited(EventBase); inherited_type = inherited_type.Parent()) {
+			if (!m_InheritedEvents[inherited_type]) {
+				m_InheritedEvents[inherited_type] = new array<EventBase>();
+			}
+			
+			m_InheritedEvents[inherited_type].Insert(event_base);
+		}
+		
+		int event_type_index = GetEventTypeIndex(event_type);
+		m_ActiveTypeCounts[event_type_index] = m_ActiveTypeCounts[event_type_index] + 1;
+		m_ActiveTypeMask.Set(event_type_index);
+	}
+	
+	protected void RemoveActiveEvent(EventBase event_base)
+	{
+		typename event_type = event_base.Type();
+		int event_id = event_base.GetID();
+		if (!m_ActiveEvents || !m_ActiveTypeCounts || !m_ActiveTypeMask || !m_ActiveEvents[event_type] || !m_ActiveEvents[event_type].Contains(event_id)) {
+			return;
+		}
+		
+		// a different event owns this slot, this happens when a rejected instance from StartEvent is cleaned up
+		EventBase active_event = m_ActiveEvents[event_type][event_id];
+		if (active_event && active_event != event_base) {
+			return;
+		}
+		
+		m_ActiveEventCount--;
+		MarkCheckpointDirty();
+		if (m_RpcRoutes) {
+			UnsubscribeRPCs(event_base);
+		}
+		
+		if (m_LocalizedEvents) {
+			m_LocalizedEvents.RemoveItem(event_base);
+		}
+		
+		if (m_InheritedEvents) {
+			for (typename inherited_type = event_type; inherited_type && inherited_type.IsInherited(EventBase); inherited_type = inherited_type.Parent()) {
+				if (m_InheritedEvents[inherited_type]) {
+					m_InheritedEvents[inherited_type].RemoveItem(event_base);
+				}
+			}
+		}
+		
+		int event_type_index = GetEventTypeIndex(event_type);
+		m_ActiveTypeCounts[event_type_index] = m_ActiveTypeCounts[event_type_index] - 1;
+		if (m_ActiveTypeCounts[event_type_index] <= 0) {
+			m_ActiveTypeCounts[event_type_index] = 0;
+			m_ActiveTypeMask.Unset(event_type_index);
+		}
+		
+		m_ActiveEvents[event_type].Remove(event_id);
+	}
+	
+	// every event type gets a compact index the first time it is seen, used for the bitsets
+	protected int GetEventTypeIndex(typename event_type)
+	{
+		int event_type_index;
+		if (m_EventTypeIndices.Find(event_type, event_type_index)) {
+			return event_type_index;
+		}
+		
+		event_type_index = m_EventTypes.Insert(event_type);
+		m_EventTypeIndices[event_type] = event_type_index;
+		m_ActiveTypeCounts.Insert(0);
+		m_ConflictMasks.Insert(null);
+		return event_type_index;
+	}
+	
+	protected BitArray GetConflictMask(typename event_type)
+	{
+		int event_type_index;
+		if (!m_EventTypeIndices.Find(event_type, event_type_index)) {
+			return null;
+		}
+		
+		return m_ConflictMasks[event_type_index];
+	}
+	
+	protected BitArray BuildConflictMask(typename event_type, notnull EventBase event_base)
+	{
+		int event_type_index = GetEventTypeIndex(event_type);
+		BitArray conflict_mask = new BitArray();
+		foreach (typename disallowed_type: event_base.GetDisallowedEvents()) {
+			conflict_mask.Set(GetEventTypeIndex(disallowed_type));
+		}
+		
+		m_ConflictMasks[event_type_index] = conflict_mask;
+		return conflict_mask;
+	}
+	
 	EventBase SpawnEvent(typename event_type)
 	{
 		if (!event_type.IsInherited(EventBase)) {
@@ -422,18 +1276,14 @@ class EventManager
 		return EventBase.Cast(event_type.Spawn());
 	}
 		
-	typename GetRandomEvent()
+	// exclude_last: never returns the previously selected event, unless it is the only one registered
+	typename GetRandomEvent(bool exclude_last = false)
 	{
-		if (m_PossibleEventTypes.Count() == 0) return typename;
-		
-		array<typename> possible_types = {};
-		foreach (typename type, float freq: m_PossibleEventTypes) {
-			for (int i = 0; i < freq * 100; i++) {
-				possible_types.Insert(type);
-			}
+		if (exclude_last) {
+			return m_EventSelectionTable.SampleExcluding(m_LastEventType);
 		}
-				
-		return possible_types.GetRandomElement();
+		
+		return m_EventSelectionTable.Sample();
 	}
 		
 	// again, you only need to worry about event_id if you allow parralel events
@@ -458,29 +1308,58 @@ class EventManager
 	array<EventBase> GetEventsInherited(typename event_type) 
 	{		
 		array<EventBase> active_events = {};
-		foreach (typename event_checked_type, EventMap event_map: m_ActiveEvents) {
-			if (!event_checked_type.IsInherited(event_type)) {
-				continue;
-			}
-			
-			foreach (int event_id, EventBase event_base: event_map) {
-				active_events.Insert(event_base);
-			}
+		GetEventsInherited(event_type, active_events);
+		return active_events;
+	}
+	
+	// fills results (cleared first) instead of allocating, returns the amount of events found
+	int GetEventsInherited(typename event_type, notnull array<EventBase> results)
+	{
+		results.Clear();
+		array<EventBase> inherited_events = m_InheritedEvents[event_type];
+		if (inherited_events) {
+			results.Copy(inherited_events);
 		}
 		
-		return active_events;
+		return results.Count();
+	}
+	
+	int CountEventsInherited(typename event_type)
+	{
+		array<EventBase> inherited_events = m_InheritedEvents[event_type];
+		if (!inherited_events) {
+			return 0;
+		}
+		
+		return inherited_events.Count();
 	}
 	
 	array<EventBase> GetActiveEvents()
 	{
-		array<EventBase> active_events = {};
-		foreach (typename event_type, EventMap event_map: m_ActiveEvents) {
-			foreach (int event_id, EventBase event_base: event_map) {
-				active_events.Insert(event_base);
+		return GetEventsInherited(EventBase);
+	}
+	
+	int GetActiveEvents(notnull array<EventBase> results)
+	{
+		return GetEventsInherited(EventBase, results);
+	}
+	
+	// calls visitor for every active event of event_type (and types inheriting from it), no allocations
+	// returns false if the visitor stopped early
+	bool ForEachEvent(notnull EventVisitor visitor, typename event_type = EventBase)
+	{
+		array<EventBase> inherited_events = m_InheritedEvents[event_type];
+		if (!inherited_events) {
+			return true;
+		}
+		
+		for (int i = 0; i < inherited_events.Count(); i++) {
+			if (inherited_events[i] && !visitor.Visit(inherited_events[i])) {
+				return false;
 			}
 		}
 		
-		return active_events;
+		return true;
 	}
 	
 	void DumpInfo()
@@ -500,13 +1379,8 @@ class EventManager
 		
 		EventManagerLog.Info(this, "New events will be selected between %1 and %2 minutes", (m_EventFreqMin / 60).ToString(), (m_EventFreqMax / 60).ToString());
 		EventManagerLog.Info(this, "There is a maximum event count of %1", m_MaxEventCount.ToString());
-		float total_freq;
-		foreach (typename typet, float freqt: m_PossibleEventTypes) {
-			total_freq += freqt;
-		}
-		
 		foreach (typename type, float freq: m_PossibleEventTypes) {
-			float value = ((1 / total_freq) * freq) * 100;
+			float value = m_EventSelectionTable.GetProbability(type) * 100;
 			EventManagerLog.Info(this, "Chance of %1 is %2 percent", type.ToString(), value.ToString());
 		}
 	}
@@ -0,0 +1,139 @@
+/*
+*
+*	EventMetrics.c
+*
+*	Production counters for the EventManager, flushed to EventMetricsLog
+*
+*	You are free to mod this as you please.
+*
+*	That being said you are NOT free to redistribute / repack this into
+*	your own mod.
+*
+*/
+
+class EventTypeMetrics: Managed
+{
+	int Selected;
+	int Started;
+	ref array<int> Rejected = {}; // indexed by EventRejectReason
+
+	int Rpcs;
+	int RpcBytes; // estimated, see EventBase::WriteState
+
+	int ServerUpdates;
+	float ServerUpdateTime; // milliseconds
+	int Deferred; // server updates pushed to a later frame by the update budget
+
+	// phase lengths, actual time taken (pauses included) over the configured length
+	float PhaseTimeActual;
+	float PhaseTimeConfigured;
+	ref Histogram PhaseRatio;
+
+	void EventTypeMetrics()
+	{
+		for (int i = 0; i < EventRejectReason.COUNT; i++) {
+			Rejected.Insert(0);
+		}
+
+		PhaseRatio = new Histogram({ 0.5, 0.9, 1.1, 1.5, 2.0 });
+	}
+}
+
+class EventMetrics: Managed
+{
+	protected ref map<typename, ref EventTypeMetrics> m_TypeMetrics = new map<typename, ref EventTypeMetrics>();
+
+	EventTypeMetrics Get(typename event_type)
+	{
+		EventTypeMetrics type_metrics = m_TypeMetrics[event_type];
+		if (!type_metrics) {
+			type_metrics = new EventTypeMetrics();
+			m_TypeMetrics[event_type] = type_metrics;
+		}
+
+		return type_metrics;
+	}
+
+	void OnSelected(typename event_type)
+	{
+		Get(event_type).Selected++;
+	}
+
+	void OnStarted(typename event_type)
+	{
+		Get(event_type).Started++;
+	}
+
+	void OnRejected(typename event_type, EventRejectReason reason)
+	{
+		EventTypeMetrics type_metrics = Get(event_type);
+		type_metrics.Rejected[reason] = type_metrics.Rejected[reason] + 1;
+	}
+
+	void OnRpc(typename event_type, int bytes)
+	{
+		EventTypeMetrics type_metrics = Get(event_type);
+		type_metrics.Rpcs++;
+		type_metrics.RpcBytes += bytes;
+	}
+
+	void OnServerUpdate(typename event_type, float milliseconds)
+	{
+		EventTypeMetrics type_metrics = Get(event_type);
+		type_metrics.ServerUpdates++;
+		type_metrics.ServerUpdateTime += milliseconds;
+	}
+
+	void OnDeferred(typename event_type)
+	{
+		Get(event_type).Deferred++;
+	}
+
+	void OnPhaseEnded(typename event_type, float actual, float configured)
+	{
+		EventTypeMetrics type_metrics = Get(event_type);
+		type_metrics.PhaseTimeActual += actual;
+		type_metrics.PhaseTimeConfigured += configured;
+		if (configured > 0) {
+			type_metrics.PhaseRatio.Add(actual / configured);
+		}
+	}
+
+	map<typename, ref EventTypeMetrics> GetTypeMetrics()
+	{
+		return m_TypeMetrics;
+	}
+
+	// writes one csv row per event type, counters are totals since the server started
+	void Flush(float time)
+	{
+		foreach (typename event_type, EventTypeMetrics type_metrics: m_TypeMetrics) {
+			string row = string.Format("%1,%2,%3,%4", time, event_type, type_metrics.Selected, type_metrics.Started);
+			foreach (int rejected: type_metrics.Rejected) {
+				row += "," + rejected.ToString();
+			}
+
+			row += string.Format(",%1,%2,%3,%4,%5", type_metrics.Rpcs, type_metrics.RpcBytes, type_metrics.PhaseRatio.GetCount(), type_metrics.PhaseTimeActual, type_metrics.PhaseTimeConfigured);
+			row += string.Format(",%1,%2,", type_metrics.PhaseRatio.GetMin(), type_metrics.PhaseRatio.GetMax());
+
+			// buckets share a column, separated by |
+			array<int> buckets = type_metrics.PhaseRatio.GetBuckets();
+			for (int i = 0; i < buckets.Count(); i++) {
+				if (i > 0) {
+					row += "|";
+				}
+
+				row += buckets[i].ToString();
+			}
+
+			row += string.Format(",%1,%2,%3", type_metrics.ServerUpdates, type_metrics.ServerUpdateTime, type_metrics.Deferred);
+
+			EventMetricsLog.Log(row);
+		}
+	}
+
+	void Clear()
+	{
+		m_TypeMetrics.Clear();
+	}
+}
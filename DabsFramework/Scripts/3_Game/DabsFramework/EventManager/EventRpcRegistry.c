@@ -0,0 +1,162 @@
+/*
+*
+*	EventRpcRegistry.c
+*
+*	Assigns small integer ids to event types, sync param types and client functions
+*	so the EventManager RPCs dont have to carry (and resolve) class names
+*
+*	You are free to mod this as you please.
+*
+*	That being said you are NOT free to redistribute / repack this into
+*	your own mod.
+*
+*/
+
+class EventRpcRegistry: Managed
+{
+	protected ref array<ref EventRpcTable> m_Tables = {};
+
+	void EventRpcRegistry()
+	{
+		for (int i = 0; i < EventRpcTableType.COUNT; i++) {
+			m_Tables.Insert(new EventRpcTable());
+		}
+	}
+
+	// Server: returns the id of name, ids created after players have joined are sent to them right away
+	// Client: returns the id the server assigned, EventRpcTable.INVALID_ID if there is none
+	int GetId(EventRpcTableType table_type, string name)
+	{
+		EventRpcTable table = m_Tables[table_type];
+		int id = table.Find(name);
+		if (id != EventRpcTable.INVALID_ID || !GetGame().IsServer()) {
+			return id;
+		}
+
+		id = table.Register(name);
+		if (GetGame().IsMultiplayer()) {
+			int count = 1;
+			ScriptRPC rpc = new ScriptRPC();
+			rpc.Write(count);
+			WriteEntry(rpc, table_type, id);
+			rpc.Send(null, ERPCsDabsFramework.EVENT_REGISTRY, true, null);
+		}
+
+		return id;
+	}
+
+	int GetEventTypeId(typename event_type)
+	{
+		return GetId(EventRpcTableType.EVENT_TYPE, event_type.ToString());
+	}
+
+	int GetFunctionId(string function_name)
+	{
+		return GetId(EventRpcTableType.FUNCTION, function_name);
+	}
+
+	typename GetEventType(int id)
+	{
+		return m_Tables[EventRpcTableType.EVENT_TYPE].GetType(id);
+	}
+
+	string GetFunctionName(int id)
+	{
+		return m_Tables[EventRpcTableType.FUNCTION].GetName(id);
+	}
+
+	// null params are written as EventRpcTable.INVALID_ID
+	// returns the estimated amount of bytes written, see SerializableParam::GetSerializedSize
+	int WriteParam(Serializer ctx, SerializableParam param)
+	{
+		int id = EventRpcTable.INVALID_ID;
+		if (param) {
+			id = GetId(EventRpcTableType.PARAM_TYPE, param.GetSerializeableType());
+		}
+
+		ctx.Write(id);
+		if (!param) {
+			return 4;
+		}
+
+		param.Write(ctx);
+		return 4 + param.GetSerializedSize();
+	}
+
+	// returns false when the ctx could not be read, param is left null when none was sent
+	bool ReadParam(Serializer ctx, out SerializableParam param)
+	{
+		int id;
+		if (!ctx.Read(id)) {
+			return false;
+		}
+
+		if (id == EventRpcTable.INVALID_ID) {
+			return true;
+		}
+
+		typename param_type = m_Tables[EventRpcTableType.PARAM_TYPE].GetType(id);
+		if (!param_type) {
+			EventManagerLog.Info(this, "Unknown param type id %1", id.ToString());
+			return false;
+		}
+
+		param = SerializableParam.Cast(param_type.Spawn());
+		if (!param) {
+			return false;
+		}
+
+		param.Read(ctx);
+		return true;
+	}
+
+	// Sends every table to identity, needs to happen before any event data when a player joins
+	void SendTo(PlayerIdentity identity)
+	{
+		int count;
+		foreach (EventRpcTable table: m_Tables) {
+			count += table.Count();
+		}
+
+		ScriptRPC rpc = new ScriptRPC();
+		rpc.Write(count);
+		for (int table_type = 0; table_type < m_Tables.Count(); table_type++) {
+			for (int id = 0; id < m_Tables[table_type].Count(); id++) {
+				WriteEntry(rpc, table_type, id);
+			}
+		}
+
+		rpc.Send(null, ERPCsDabsFramework.EVENT_REGISTRY, true, identity);
+	}
+
+	bool Read(ParamsReadContext ctx)
+	{
+		int count;
+		if (!ctx.Read(count)) {
+			return false;
+		}
+
+		for (int i = 0; i < count; i++) {
+			int table_type, id;
+			string name;
+			if (!ctx.Read(table_type) || !ctx.Read(id) || !ctx.Read(name)) {
+				return false;
+			}
+
+			if (table_type < 0 || table_type >= m_Tables.Count()) {
+				continue;
+			}
+
+			m_Tables[table_type].Set(id, name);
+		}
+
+		return true;
+	}
+
+	protected void WriteEntry(Serializer ctx, int table_type, int id)
+	{
+		ctx.Write(table_type);
+		ctx.Write(id);
+		ctx.Write(m_Tables[table_type].GetName(id));
+	}
+}
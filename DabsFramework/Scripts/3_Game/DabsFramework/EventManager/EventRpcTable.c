@@ -0,0 +1,87 @@
+/*
+*
+*	EventRpcTable.c
+*
+*	Append-only string <-> id table, one per EventRpcTableType
+*
+*	You are free to mod this as you please.
+*
+*	That being said you are NOT free to redistribute / repack this into
+*	your own mod.
+*
+*/
+
+class EventRpcTable: Managed
+{
+	static const int INVALID_ID = -1;
+
+	protected ref map<string, int> m_Ids = new map<string, int>();
+	protected ref array<string> m_Names = {};
+
+	// resolved once when the entry is added, so clients never have to call ToType() on the hot path
+	protected ref array<typename> m_Types = {};
+
+	// returns INVALID_ID when name has no id
+	int Find(string name)
+	{
+		int id;
+		if (!m_Ids.Find(name, id)) {
+			return INVALID_ID;
+		}
+
+		return id;
+	}
+
+	// returns the id of name, assigning the next free one if it doesnt have one yet
+	int Register(string name)
+	{
+		int id = Find(name);
+		if (id != INVALID_ID) {
+			return id;
+		}
+
+		id = m_Names.Count();
+		Set(id, name);
+		return id;
+	}
+
+	// used by clients to mirror the server table
+	void Set(int id, string name)
+	{
+		if (id < 0) {
+			return;
+		}
+
+		if (id >= m_Names.Count()) {
+			m_Names.Resize(id + 1);
+			m_Types.Resize(id + 1);
+		}
+
+		m_Names[id] = name;
+		m_Types[id] = name.ToType();
+		m_Ids[name] = id;
+	}
+
+	string GetName(int id)
+	{
+		if (id < 0 || id >= m_Names.Count()) {
+			return string.Empty;
+		}
+
+		return m_Names[id];
+	}
+
+	typename GetType(int id)
+	{
+		if (id < 0 || id >= m_Types.Count()) {
+			return typename;
+		}
+
+		return m_Types[id];
+	}
+
+	int Count()
+	{
+		return m_Names.Count();
+	}
+}
@@ -0,0 +1,213 @@
+/*
+*
+*	EventScheduler.c
+*
+*	Hierarchical timing wheel used by the EventManager to drive every
+*	event update from a single per-frame callback
+*
+*	You are free to mod this as you please.
+*
+*	That being said you are NOT free to redistribute / repack this into
+*	your own mod.
+*
+*/
+
+/*
+	Each level holds WHEEL_SIZE slots, a slot on level N spans WHEEL_SIZE^N ticks.
+	Tasks are placed on the lowest level that can hold their remaining delay and cascade
+	down a level each time the wheel below them rolls over, so each tick only ever has to
+	look at a single slot no matter how many tasks are pending.
+
+	Level 0: 64 slots of 0.01s		(0.64 seconds)
+	Level 1: 64 slots of 0.64s		(~41 seconds)
+	Level 2: 64 slots of ~41s		(~44 minutes)
+	Level 3: 64 slots of ~44m		(~46 hours)
+*/
+class EventScheduler: Managed
+{
+	// seconds per tick
+	static const float RESOLUTION = 0.01;
+
+	static const int WHEEL_BITS = 6;
+	static const int WHEEL_SIZE = 64;
+	static const int WHEEL_MASK = 63;
+	static const int WHEEL_LEVELS = 4;
+
+	protected int m_CurrentTick;
+	protected int m_FrameTick;
+	protected float m_Remainder;
+
+	// m_Slots[level * WHEEL_SIZE + slot]
+	protected ref array<ref array<EventSchedulerTask>> m_Slots = {};
+
+	// re-used every tick to avoid allocating while firing / cascading
+	protected ref array<EventSchedulerTask> m_Firing = {};
+	protected ref array<EventSchedulerTask> m_Cascading = {};
+
+	void EventScheduler()
+	{
+		for (int i = 0; i < WHEEL_LEVELS * WHEEL_SIZE; i++) {
+			m_Slots.Insert(new array<EventSchedulerTask>());
+		}
+	}
+
+	// Call once per frame, runs every task that expired since the last call
+	void Update(float dt)
+	{
+		m_Remainder += dt;
+		int ticks = m_Remainder / RESOLUTION;
+		if (ticks <= 0) {
+			return;
+		}
+
+		m_Remainder -= ticks * RESOLUTION;
+		m_FrameTick = m_CurrentTick + ticks;
+		while (m_CurrentTick < m_FrameTick) {
+			Tick();
+		}
+	}
+
+	// (re)schedules task to run in 'delay' seconds, replaces any pending execution
+	void Schedule(notnull EventSchedulerTask task, float delay)
+	{
+		Cancel(task);
+
+		int ticks = Math.Ceil(delay / RESOLUTION);
+		task.m_ExpiryTick = m_CurrentTick + Math.Max(ticks, 1);
+		Insert(task);
+	}
+
+	void Cancel(EventSchedulerTask task)
+	{
+		if (!task || task.m_Level == EventSchedulerTask.UNSCHEDULED) {
+			return;
+		}
+
+		// currently in the firing list, just flag it so it gets skipped
+		if (task.m_Level != EventSchedulerTask.FIRING) {
+			m_Slots[task.m_Level * WHEEL_SIZE + task.m_Slot].RemoveItem(task);
+		}
+
+		task.m_Level = EventSchedulerTask.UNSCHEDULED;
+		task.m_Slot = EventSchedulerTask.UNSCHEDULED;
+	}
+
+	// seconds remaining until task runs, -1 if not scheduled
+	float GetRemaining(EventSchedulerTask task)
+	{
+		if (!task || !task.IsScheduled()) {
+			return -1;
+		}
+
+		return (task.m_ExpiryTick - m_CurrentTick) * RESOLUTION - m_Remainder;
+	}
+
+	// seconds since the scheduler was created
+	float GetTime()
+	{
+		return m_CurrentTick * RESOLUTION + m_Remainder;
+	}
+
+	int GetCurrentTick()
+	{
+		return m_CurrentTick;
+	}
+
+	protected void Tick()
+	{
+		m_CurrentTick++;
+
+		// cascade higher levels down whenever the level below rolls over
+		for (int level = 1; level < WHEEL_LEVELS; level++) {
+			if (m_CurrentTick & ((1 << (WHEEL_BITS * level)) - 1)) {
+				break;
+			}
+
+			Cascade(level, (m_CurrentTick >> (WHEEL_BITS * level)) & WHEEL_MASK);
+		}
+
+		array<EventSchedulerTask> slot = m_Slots[m_CurrentTick & WHEEL_MASK];
+		if (slot.Count() == 0) {
+			return;
+		}
+
+		m_Firing.Copy(slot);
+		slot.Clear();
+
+		foreach (EventSchedulerTask firing_task: m_Firing) {
+			if (firing_task) {
+				firing_task.m_Level = EventSchedulerTask.FIRING;
+			}
+		}
+
+		for (int i = 0; i < m_Firing.Count(); i++) {
+			EventSchedulerTask task = m_Firing[i];
+
+			// cancelled or destroyed by a task that ran before it
+			if (!task || task.m_Level != EventSchedulerTask.FIRING) {
+				continue;
+			}
+
+			// clamped beyond the top level, not actually due yet
+			if (task.m_ExpiryTick > m_CurrentTick) {
+				Insert(task);
+				continue;
+			}
+
+			task.m_Level = EventSchedulerTask.UNSCHEDULED;
+			task.m_Slot = EventSchedulerTask.UNSCHEDULED;
+			task.Execute();
+
+			// the task can delete its owner (and itself) when executing
+			if (!task || !task.IsRepeating() || task.IsScheduled()) {
+				continue;
+			}
+
+			// repeating tasks run at most once per frame, same as a looping Timer would
+			int interval_ticks = Math.Max(Math.Ceil(task.GetInterval() / RESOLUTION), 1);
+			task.m_ExpiryTick = Math.Max(m_CurrentTick + interval_ticks, m_FrameTick + 1);
+			Insert(task);
+		}
+
+		m_Firing.Clear();
+	}
+
+	protected void Cascade(int level, int slot_index)
+	{
+		array<EventSchedulerTask> slot = m_Slots[level * WHEEL_SIZE + slot_index];
+		if (slot.Count() == 0) {
+			return;
+		}
+
+		m_Cascading.Copy(slot);
+		slot.Clear();
+
+		foreach (EventSchedulerTask task: m_Cascading) {
+			if (task) {
+				Insert(task);
+			}
+		}
+
+		m_Cascading.Clear();
+	}
+
+	protected void Insert(EventSchedulerTask task)
+	{
+		int delta = task.m_ExpiryTick - m_CurrentTick;
+		int level;
+		while (level < WHEEL_LEVELS - 1 && delta >= (1 << (WHEEL_BITS * (level + 1)))) {
+			level++;
+		}
+
+		// further out than the wheel can hold, park it in the furthest slot and re-check when it cascades
+		int slot_tick = task.m_ExpiryTick;
+		int max_delta = (1 << (WHEEL_BITS * WHEEL_LEVELS)) - 1;
+		if (delta > max_delta) {
+			slot_tick = m_CurrentTick + max_delta;
+		}
+
+		task.m_Level = level;
+		task.m_Slot = (slot_tick >> (WHEEL_BITS * level)) & WHEEL_MASK;
+		m_Slots[level * WHEEL_SIZE + task.m_Slot].Insert(task);
+	}
+}
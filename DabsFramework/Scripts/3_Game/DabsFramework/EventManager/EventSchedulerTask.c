@@ -0,0 +1,54 @@
+/*
+*
+*	EventSchedulerTask.c
+*
+*	A single unit of work run by the EventScheduler
+*
+*	You are free to mod this as you please.
+*
+*	That being said you are NOT free to redistribute / repack this into
+*	your own mod.
+*
+*/
+
+class EventSchedulerTask: Managed
+{
+	static const int UNSCHEDULED = -1;
+	static const int FIRING = -2;
+
+	// Managed by the EventScheduler, do not touch these
+	int m_ExpiryTick;
+	int m_Level = UNSCHEDULED;
+	int m_Slot = UNSCHEDULED;
+
+	// seconds between each execution, 0 runs the task once
+	protected float m_Interval;
+
+	void EventSchedulerTask(float interval = 0)
+	{
+		m_Interval = interval;
+	}
+
+	// Abstract
+	void Execute();
+
+	void SetInterval(float interval)
+	{
+		m_Interval = interval;
+	}
+
+	float GetInterval()
+	{
+		return m_Interval;
+	}
+
+	bool IsRepeating()
+	{
+		return m_Interval > 0;
+	}
+
+	bool IsScheduled()
+	{
+		return m_Level != UNSCHEDULED;
+	}
+}
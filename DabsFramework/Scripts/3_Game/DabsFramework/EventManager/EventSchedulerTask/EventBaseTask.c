@@ -0,0 +1,37 @@
+/*
+*
+*	EventBaseTask.c
+*
+*	Scheduler task that forwards to one of the update loops of an EventBase
+*
+*	You are free to mod this as you please.
+*
+*	That being said you are NOT free to redistribute / repack this into
+*	your own mod.
+*
+*/
+
+class EventBaseTask: EventSchedulerTask
+{
+	protected EventBase m_EventBase;
+	protected EventTaskType m_TaskType;
+
+	void EventBaseTask(EventBase event_base, EventTaskType task_type, float interval = 0)
+	{
+		m_EventBase = event_base;
+		m_TaskType = task_type;
+		m_Interval = interval;
+	}
+
+	override void Execute()
+	{
+		if (m_EventBase) {
+			m_EventBase.OnScheduledTask(m_TaskType);
+		}
+	}
+
+	EventTaskType GetTaskType()
+	{
+		return m_TaskType;
+	}
+}
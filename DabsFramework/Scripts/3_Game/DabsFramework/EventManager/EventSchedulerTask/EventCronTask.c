@@ -0,0 +1,30 @@
+/*
+*
+*	EventCronTask.c
+*
+*	Scheduler task that wakes the EventManager when the next wall-clock scheduled event is due
+*
+*	You are free to mod this as you please.
+*
+*	That being said you are NOT free to redistribute / repack this into
+*	your own mod.
+*
+*/
+
+class EventCronTask: EventSchedulerTask
+{
+	protected EventManager m_EventManager;
+
+	// one-shot, rescheduled for whatever entry is due next
+	void EventCronTask(EventManager event_manager)
+	{
+		m_EventManager = event_manager;
+	}
+
+	override void Execute()
+	{
+		if (m_EventManager) {
+			m_EventManager.RunCronSchedule();
+		}
+	}
+}
@@ -0,0 +1,30 @@
+/*
+*
+*	EventMetricsTask.c
+*
+*	Scheduler task that periodically flushes the EventManager metrics
+*
+*	You are free to mod this as you please.
+*
+*	That being said you are NOT free to redistribute / repack this into
+*	your own mod.
+*
+*/
+
+class EventMetricsTask: EventSchedulerTask
+{
+	protected EventManager m_EventManager;
+
+	void EventMetricsTask(EventManager event_manager, float interval = 0)
+	{
+		m_EventManager = event_manager;
+		m_Interval = interval;
+	}
+
+	override void Execute()
+	{
+		if (m_EventManager) {
+			m_EventManager.FlushMetrics();
+		}
+	}
+}
@@ -0,0 +1,30 @@
+/*
+*
+*	EventRelevancyTask.c
+*
+*	Scheduler task that refreshes which clients are inside the area of localized events
+*
+*	You are free to mod this as you please.
+*
+*	That being said you are NOT free to redistribute / repack this into
+*	your own mod.
+*
+*/
+
+class EventRelevancyTask: EventSchedulerTask
+{
+	protected EventManager m_EventManager;
+
+	// one-shot, UpdateRelevancy reschedules it for as long as there are localized events
+	void EventRelevancyTask(EventManager event_manager)
+	{
+		m_EventManager = event_manager;
+	}
+
+	override void Execute()
+	{
+		if (m_EventManager) {
+			m_EventManager.UpdateRelevancy();
+		}
+	}
+}
@@ -0,0 +1,36 @@
+/*
+*
+*	EventVisitor.c
+*
+*	Callback for EventManager::ForEachEvent, walks the active events without building an array
+*
+*	You are free to mod this as you please.
+*
+*	That being said you are NOT free to redistribute / repack this into
+*	your own mod.
+*
+*/
+
+/*
+	class StormCounter: EventVisitor
+	{
+		int Count;
+
+		override bool Visit(EventBase event_base)
+		{
+			Count++;
+			return true;
+		}
+	}
+
+	StormCounter counter = new StormCounter();
+	EventManager.GetInstance().ForEachEvent(counter, StormEvent);
+*/
+class EventVisitor: Managed
+{
+	// return false to stop visiting. do not start or cancel events from here, collect them and do it afterwards
+	bool Visit(EventBase event_base)
+	{
+		return true;
+	}
+}
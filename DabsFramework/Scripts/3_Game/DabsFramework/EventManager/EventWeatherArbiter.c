@@ -0,0 +1,258 @@
+/*
+*
+*	EventWeatherArbiter.c
+*
+*	Resolves overlapping WeatherEvent requests, owned by the EventManager
+*
+*	You are free to mod this as you please.
+*
+*	That being said you are NOT free to redistribute / repack this into
+*	your own mod.
+*
+*/
+
+// Indexed binary max-heap of weather targets, one entry per event holding the weather (INIT and MID phases)
+class EventWeatherTargetHeap: Managed
+{
+	protected ref array<float> m_Targets = {};
+	protected ref array<EventBase> m_Events = {};
+	protected ref map<EventBase, int> m_Indices = new map<EventBase, int>();
+
+	// inserts or updates the target of event_base
+	void Set(EventBase event_base, float target)
+	{
+		int index;
+		if (!m_Indices.Find(event_base, index)) {
+			index = m_Targets.Insert(target);
+			m_Events.Insert(event_base);
+			m_Indices[event_base] = index;
+			SiftUp(index);
+			return;
+		}
+
+		float previous = m_Targets[index];
+		m_Targets[index] = target;
+		if (target > previous) {
+			SiftUp(index);
+		} else {
+			SiftDown(index);
+		}
+	}
+
+	void Remove(EventBase event_base)
+	{
+		int index;
+		if (!m_Indices.Find(event_base, index)) {
+			return;
+		}
+
+		int last = m_Targets.Count() - 1;
+		Swap(index, last);
+		m_Targets.Remove(last);
+		m_Events.Remove(last);
+		m_Indices.Remove(event_base);
+
+		if (index < last) {
+			SiftUp(index);
+			SiftDown(index);
+		}
+	}
+
+	// highest target of any event but exclude, 0 when there is none. O(1)
+	float GetCeiling(EventBase exclude = null)
+	{
+		int count = m_Targets.Count();
+		if (count == 0) {
+			return 0;
+		}
+
+		if (m_Events[0] != exclude) {
+			return Math.Max(m_Targets[0], 0);
+		}
+
+		// the next highest is always one of the children of the top
+		float ceiling = 0;
+		for (int i = 1; i <= 2 && i < count; i++) {
+			ceiling = Math.Max(ceiling, m_Targets[i]);
+		}
+
+		return ceiling;
+	}
+
+	int Count()
+	{
+		return m_Targets.Count();
+	}
+
+	protected void SiftUp(int index)
+	{
+		while (index > 0) {
+			int parent = (index - 1) / 2;
+			if (m_Targets[parent] >= m_Targets[index]) {
+				break;
+			}
+
+			Swap(index, parent);
+			index = parent;
+		}
+	}
+
+	protected void SiftDown(int index)
+	{
+		int count = m_Targets.Count();
+		while (true) {
+			int largest = index;
+			int left = index * 2 + 1;
+			int right = left + 1;
+			if (left < count && m_Targets[left] > m_Targets[largest]) {
+				largest = left;
+			}
+
+			if (right < count && m_Targets[right] > m_Targets[largest]) {
+				largest = right;
+			}
+
+			if (largest == index) {
+				break;
+			}
+
+			Swap(index, largest);
+			index = largest;
+		}
+	}
+
+	protected void Swap(int a, int b)
+	{
+		float target = m_Targets[a];
+		m_Targets[a] = m_Targets[b];
+		m_Targets[b] = target;
+
+		EventBase event_base = m_Events[a];
+		m_Events[a] = m_Events[b];
+		m_Events[b] = event_base;
+
+		m_Indices[m_Events[a]] = a;
+		m_Indices[m_Events[b]] = b;
+	}
+}
+
+class EventWeatherArbiter: Managed
+{
+	static const int PHENOMENON_COUNT = EWeatherPhenomenon.RAIN + 1;
+
+	protected ref array<ref EventWeatherTargetHeap> m_Heaps = {};
+
+	// requests made this frame, only the last of each is sent to the weather in Flush
+	protected ref array<bool> m_PendingSet = {};
+	protected ref array<float> m_SetValues = {};
+	protected ref array<float> m_SetTimes = {};
+	protected ref array<float> m_SetDurations = {};
+	protected ref array<bool> m_PendingLimits = {};
+	protected ref array<float> m_LimitLows = {};
+	protected ref array<float> m_LimitHighs = {};
+	protected bool m_Dirty;
+
+	void EventWeatherArbiter()
+	{
+		for (int i = 0; i < PHENOMENON_COUNT; i++) {
+			m_Heaps.Insert(new EventWeatherTargetHeap());
+			m_PendingSet.Insert(false);
+			m_SetValues.Insert(0);
+			m_SetTimes.Insert(0);
+			m_SetDurations.Insert(0);
+			m_PendingLimits.Insert(false);
+			m_LimitLows.Insert(0);
+			m_LimitHighs.Insert(0);
+		}
+	}
+
+	// keeps the targets of weather_event in the heaps while phase is INIT or MID, drops them after
+	void OnPhaseChanged(notnull WeatherEvent weather_event, EventPhase phase)
+	{
+		for (int i = 0; i < PHENOMENON_COUNT; i++) {
+			float target = weather_event.GetWeatherTarget(i);
+			if (phase >= EventPhase.INIT && phase <= EventPhase.MID && target != -1) {
+				m_Heaps[i].Set(weather_event, target);
+			} else {
+				m_Heaps[i].Remove(weather_event);
+			}
+		}
+	}
+
+	void Remove(EventBase event_base)
+	{
+		foreach (EventWeatherTargetHeap heap: m_Heaps) {
+			heap.Remove(event_base);
+		}
+	}
+
+	// highest target any event other than exclude is holding weather_type at, 0 when none are
+	float GetCeiling(EWeatherPhenomenon weather_type, EventBase exclude = null)
+	{
+		if (weather_type < 0 || weather_type >= PHENOMENON_COUNT) {
+			return 0;
+		}
+
+		return m_Heaps[weather_type].GetCeiling(exclude);
+	}
+
+	// the limits the phenomenon will have after this frame
+	void GetLimits(EWeatherPhenomenon weather_type, out float low, out float high)
+	{
+		if (m_PendingLimits[weather_type]) {
+			low = m_LimitLows[weather_type];
+			high = m_LimitHighs[weather_type];
+			return;
+		}
+
+		WeatherPhenomenon weather_phenomenon = WeatherEvent.GetWeatherPhenomenon(weather_type);
+		if (weather_phenomenon) {
+			weather_phenomenon.GetLimits(low, high);
+		}
+	}
+
+	void SetLimits(EWeatherPhenomenon weather_type, float low, float high)
+	{
+		m_PendingLimits[weather_type] = true;
+		m_LimitLows[weather_type] = low;
+		m_LimitHighs[weather_type] = high;
+		m_Dirty = true;
+	}
+
+	void Set(EWeatherPhenomenon weather_type, float value, float time, float duration)
+	{
+		m_PendingSet[weather_type] = true;
+		m_SetValues[weather_type] = value;
+		m_SetTimes[weather_type] = time;
+		m_SetDurations[weather_type] = duration;
+		m_Dirty = true;
+	}
+
+	// Called once per frame by the EventManager
+	void Flush()
+	{
+		if (!m_Dirty) {
+			return;
+		}
+
+		m_Dirty = false;
+		for (int i = 0; i < PHENOMENON_COUNT; i++) {
+			WeatherPhenomenon weather_phenomenon = WeatherEvent.GetWeatherPhenomenon(i);
+			if (!weather_phenomenon) {
+				m_PendingLimits[i] = false;
+				m_PendingSet[i] = false;
+				continue;
+			}
+
+			if (m_PendingLimits[i]) {
+				weather_phenomenon.SetLimits(m_LimitLows[i], m_LimitHighs[i]);
+				m_PendingLimits[i] = false;
+			}
+
+			if (m_PendingSet[i]) {
+				weather_phenomenon.Set(m_SetValues[i], m_SetTimes[i], m_SetDurations[i]);
+				m_PendingSet[i] = false;
+			}
+		}
+	}
+}
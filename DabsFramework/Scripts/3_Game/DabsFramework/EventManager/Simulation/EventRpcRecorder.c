@@ -0,0 +1,61 @@
+/*
+*
+*	EventRpcRecorder.c
+*
+*	Stands in for the network while the EventManager is being simulated, counts every rpc instead of sending it
+*
+*	You are free to mod this as you please.
+*
+*	That being said you are NOT free to redistribute / repack this into
+*	your own mod.
+*
+*/
+
+class EventRpcRecorder: Managed
+{
+	protected int m_Count;
+	protected int m_BroadcastCount;
+	protected ref map<int, int> m_CountByRpcType = new map<int, int>();
+	protected ref map<typename, int> m_CountByEventType = new map<typename, int>();
+
+	void Record(int rpc_type, PlayerIdentity identity, EventBase event_base)
+	{
+		m_Count++;
+		if (!identity) {
+			m_BroadcastCount++;
+		}
+
+		m_CountByRpcType[rpc_type] = m_CountByRpcType[rpc_type] + 1;
+		if (event_base) {
+			m_CountByEventType[event_base.Type()] = m_CountByEventType[event_base.Type()] + 1;
+		}
+	}
+
+	int GetCount()
+	{
+		return m_Count;
+	}
+
+	int GetBroadcastCount()
+	{
+		return m_BroadcastCount;
+	}
+
+	map<int, int> GetCountByRpcType()
+	{
+		return m_CountByRpcType;
+	}
+
+	map<typename, int> GetCountByEventType()
+	{
+		return m_CountByEventType;
+	}
+
+	void Clear()
+	{
+		m_Count = 0;
+		m_BroadcastCount = 0;
+		m_CountByRpcType.Clear();
+		m_CountByEventType.Clear();
+	}
+}
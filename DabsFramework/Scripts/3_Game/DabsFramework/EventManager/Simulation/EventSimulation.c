@@ -0,0 +1,186 @@
+/*
+*
+*	EventSimulation.c
+*
+*	Headless benchmark for the EventManager, replays hours of event scheduling in a single call
+*	by stepping a private EventManager on a virtual clock instead of the frame loop
+*
+*	You are free to mod this as you please.
+*
+*	That being said you are NOT free to redistribute / repack this into
+*	your own mod.
+*
+*/
+
+class EventSimulationSettings: Managed
+{
+	float Duration = 21600; // simulated seconds
+	float Step = 0.1; // simulated seconds per OnUpdate, same as running at 10fps
+	int Seed = 1; // 0 leaves the random generator alone, anything else makes the run repeatable
+	int MinBetweenEvents = 550;
+	int MaxBetweenEvents = 3500;
+	int MaxEventCount = 2;
+	string ReportFile = "$profile:\\EventSimulation.json";
+
+	// event typename -> frequency, same as EventManager::RegisterEvent
+	ref map<string, float> Events = new map<string, float>();
+}
+
+class EventSimulationReport: Managed
+{
+	float SimulatedSeconds;
+	float RealMilliseconds;
+	float SimulatedSecondsPerRealSecond;
+	int Updates;
+	float UpdatesPerRealSecond;
+
+	// events created during the run, the script vm has no heap counters to read instead
+	int EventsSpawned;
+
+	// rpcs sent during the run
+	int RpcsRecorded;
+
+	int EventsSelected;
+	int EventsStarted;
+	int EventsRejected;
+	int RpcsBroadcast;
+
+	ref map<string, int> Selections = new map<string, int>();
+	ref map<string, int> Started = new map<string, int>();
+	ref map<string, int> Rejected = new map<string, int>();
+	ref map<string, int> RpcsByEventType = new map<string, int>();
+	ref map<string, int> RpcsByRpcType = new map<string, int>();
+}
+
+/*
+	Runs automatically in the Missions/Dev overlay when $mission:eventsimulation.json exists,
+	the shipped file has no Events, fill in your own event typenames and frequencies
+	(EventBase and WeatherEvent are abstract and wont show anything useful). Or from script:
+
+	EventSimulationSettings settings = new EventSimulationSettings();
+	settings.Events["MyStorm"] = 1.0;
+	EventSimulationReport report = EventSimulation.Run(settings);
+*/
+class EventSimulation
+{
+	static const string SETTINGS_FILE = "$mission:eventsimulation.json";
+
+	// both owned here while the simulated manager stands in for the live one
+	protected static ref EventManager m_LiveManager;
+	protected static ref EventSimulationManager m_SimulationManager;
+
+	static EventSimulationReport RunFromFile(string file = SETTINGS_FILE)
+	{
+		if (!FileExist(file)) {
+			return null;
+		}
+
+		EventSimulationSettings settings = new EventSimulationSettings();
+		JsonFileLoader<EventSimulationSettings>.JsonLoadFile(file, settings);
+		return Run(settings);
+	}
+
+	static EventSimulationReport Run(notnull EventSimulationSettings settings)
+	{
+		if (!GetGame().IsServer() || GetGame().IsMultiplayer()) {
+			EventManagerLog.Info(null, "EventSimulation can only run offline");
+			return null;
+		}
+
+		if (settings.Step <= 0) {
+			return null;
+		}
+
+		if (settings.Events.Count() == 0) {
+			EventManagerLog.Info(null, "EventSimulation: no Events configured, add event typename -> frequency to %1", SETTINGS_FILE);
+			return null;
+		}
+
+		if (settings.Seed != 0) {
+			Math.Randomize(settings.Seed);
+		}
+
+		// events look their manager up through the game, so the simulated one has to take its place for the run
+		m_LiveManager = GetDayZGame().GetEventManager();
+		m_SimulationManager = new EventSimulationManager();
+		GetDayZGame().SetEventManager(m_SimulationManager);
+
+		EventSimulationManager simulation_manager = m_SimulationManager;
+
+		foreach (string event_name, float frequency: settings.Events) {
+			if (!event_name.ToType()) {
+				EventManagerLog.Info(null, "EventSimulation: unknown event type %1", event_name);
+				continue;
+			}
+
+			simulation_manager.RegisterEvent(event_name.ToType(), frequency);
+		}
+
+		simulation_manager.Run(settings.MinBetweenEvents, settings.MaxBetweenEvents, settings.MaxEventCount);
+
+		EventSimulationReport report = new EventSimulationReport();
+		int start_tick = TickCount(0);
+		while (report.SimulatedSeconds < settings.Duration) {
+			simulation_manager.OnUpdate(settings.Step);
+			report.SimulatedSeconds += settings.Step;
+			report.Updates++;
+		}
+
+		report.RealMilliseconds = TickCount(start_tick) / EventManager.TICKS_PER_MILLISECOND;
+
+		// let everything still running end the normal way before the live manager is put back
+		foreach (EventBase event_base: simulation_manager.GetActiveEvents()) {
+			if (event_base) {
+				simulation_manager.CancelEvent(event_base);
+			}
+		}
+
+		FillReport(report, simulation_manager);
+		GetDayZGame().SetEventManager(m_LiveManager);
+		m_LiveManager = null;
+		m_SimulationManager = null;
+
+		if (settings.ReportFile != string.Empty) {
+			JsonFileLoader<EventSimulationReport>.JsonSaveFile(settings.ReportFile, report);
+		}
+
+		EventManagerLog.Info(null, "EventSimulation: %1 simulated seconds in %2ms, %3 events started, %4 rpcs", report.SimulatedSeconds.ToString(), report.RealMilliseconds.ToString(), report.EventsStarted.ToString(), report.RpcsRecorded.ToString());
+		return report;
+	}
+
+	protected static void FillReport(EventSimulationReport report, EventSimulationManager simulation_manager)
+	{
+		if (report.RealMilliseconds > 0) {
+			report.SimulatedSecondsPerRealSecond = report.SimulatedSeconds / report.RealMilliseconds * 1000;
+			report.UpdatesPerRealSecond = report.Updates / report.RealMilliseconds * 1000;
+		}
+
+		report.EventsSpawned = simulation_manager.GetEventsSpawned();
+
+		foreach (typename selected_type, int selected: simulation_manager.GetSelections()) {
+			report.Selections[selected_type.ToString()] = selected;
+			report.EventsSelected += selected;
+		}
+
+		foreach (typename started_type, int started: simulation_manager.GetStarted()) {
+			report.Started[started_type.ToString()] = started;
+			report.EventsStarted += started;
+		}
+
+		foreach (typename rejected_type, int rejected: simulation_manager.GetRejected()) {
+			report.Rejected[rejected_type.ToString()] = rejected;
+			report.EventsRejected += rejected;
+		}
+
+		EventRpcRecorder rpc_recorder = simulation_manager.GetRpcRecorder();
+		report.RpcsRecorded = rpc_recorder.GetCount();
+		report.RpcsBroadcast = rpc_recorder.GetBroadcastCount();
+		foreach (typename rpc_event_type, int event_rpcs: rpc_recorder.GetCountByEventType()) {
+			report.RpcsByEventType[rpc_event_type.ToString()] = event_rpcs;
+		}
+
+		foreach (int rpc_type, int type_rpcs: rpc_recorder.GetCountByRpcType()) {
+			report.RpcsByRpcType[rpc_type.ToString()] = type_rpcs;
+		}
+	}
+}
@@ -0,0 +1,94 @@
+/*
+*
+*	EventSimulationManager.c
+*
+*	EventManager used by EventSimulation, records rpcs and selections and never touches the checkpoint
+*
+*	You are free to mod this as you please.
+*
+*	That being said you are NOT free to redistribute / repack this into
+*	your own mod.
+*
+*/
+
+class EventSimulationManager: EventManager
+{
+	protected ref EventRpcRecorder m_RpcRecorder = new EventRpcRecorder();
+
+	protected int m_EventsSpawned;
+	protected ref map<typename, int> m_Selections = new map<typename, int>();
+	protected ref map<typename, int> m_Started = new map<typename, int>();
+	protected ref map<typename, int> m_Rejected = new map<typename, int>();
+
+	override typename GetRandomEvent(bool exclude_last = false)
+	{
+		typename event_type = super.GetRandomEvent(exclude_last);
+		m_Selections[event_type] = m_Selections[event_type] + 1;
+		return event_type;
+	}
+
+	override EventBase StartEvent(typename event_type, bool force = false, Param startup_params = null)
+	{
+		EventBase event_base = super.StartEvent(event_type, force, startup_params);
+		if (event_base) {
+			m_Started[event_type] = m_Started[event_type] + 1;
+		} else {
+			m_Rejected[event_type] = m_Rejected[event_type] + 1;
+		}
+
+		return event_base;
+	}
+
+	override EventBase SpawnEvent(typename event_type)
+	{
+		EventBase event_base = super.SpawnEvent(event_type);
+		if (event_base) {
+			m_EventsSpawned++;
+		}
+
+		return event_base;
+	}
+
+	override protected void SendRPC(ScriptRPC rpc, int rpc_type, PlayerIdentity identity, EventBase event_base = null, int size = 0)
+	{
+		m_RpcRecorder.Record(rpc_type, identity, event_base);
+	}
+
+	override void FlushMetrics()
+	{
+	}
+
+	override protected void WriteCheckpoint()
+	{
+		m_CheckpointDirty = false;
+	}
+
+	override protected void RestoreCheckpoint()
+	{
+	}
+
+	EventRpcRecorder GetRpcRecorder()
+	{
+		return m_RpcRecorder;
+	}
+
+	int GetEventsSpawned()
+	{
+		return m_EventsSpawned;
+	}
+
+	map<typename, int> GetSelections()
+	{
+		return m_Selections;
+	}
+
+	map<typename, int> GetStarted()
+	{
+		return m_Started;
+	}
+
+	map<typename, int> GetRejected()
+	{
+		return m_Rejected;
+	}
+}
@@ -0,0 +1,27 @@
+// csv, one row per event type every time the EventManager flushes its metrics
+[RegisterLogger(EventMetricsLog)]
+class EventMetricsLog: LoggerBase
+{
+	static const string HEADER = "time,event_type,selected,started,rejected_max_events,rejected_cooldown,rejected_spawn_failed,rejected_max_type_count,rejected_conflict,rejected_activate_condition,rpcs,rpc_bytes,phases,phase_time_actual,phase_time_configured,phase_ratio_min,phase_ratio_max,phase_ratio_buckets,server_updates,server_update_ms,deferred";
+	
+	override void OnGameStart(notnull DayZGame game)
+	{
+		super.OnGameStart(game);
+		
+		if (m_FileName != string.Empty) {
+			FileHandle handle = OpenFile(m_FileName, FileMode.APPEND);
+			FPrintln(handle, HEADER);
+			CloseFile(handle);
+		}
+	}
+	
+	static override void Log(string log)
+	{
+		DoLog(EventMetricsLog, log);
+	}
+	
+	override string GetFileExtension()
+	{
+		return ".csv";
+	}
+}
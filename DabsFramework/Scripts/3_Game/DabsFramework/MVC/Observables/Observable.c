@@ -18,6 +18,14 @@ class Observable: Managed
 		}
 	}
 
+	// the args are reused for every change, they are only valid while CollectionChanged runs
+	protected void CollectionChanged(NotifyCollectionChangedAction changed_action, int changed_index, Param changed_value)
+	{
+		CollectionChangedEventArgs args = CollectionChangedEventArgs.Acquire(this, changed_action, changed_index, changed_value);
+		CollectionChanged(args);
+		CollectionChangedEventArgs.Release(args);
+	}
+
 	typename GetType()
 	{
 		return m_Type;
@@ -33,6 +41,9 @@ class Observable: Managed
 		return GetDayZGame().GetTypeConversion(m_Type);
 	}
 
+	// puts the item at index into type_converter, used by the range notifications
+	void ConvertItem(int index, TypeConverter type_converter);
+
 	// Abstract
 	int Count();
 }
\ No newline at end of file
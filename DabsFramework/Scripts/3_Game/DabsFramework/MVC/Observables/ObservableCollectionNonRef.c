@@ -1,6 +1,7 @@
 class ObservableCollectionNonRef<Class TValue> : Observable
 {
 	protected ref array<TValue> m_Data = {};
+	protected ref Param1Pool<TValue> m_ChangedValuePool = new Param1Pool<TValue>();
 
 	void ObservableCollectionNonRef(ViewController controller)
 	{
@@ -16,7 +17,7 @@ class ObservableCollectionNonRef<Class TValue> : Observable
 	{
 		int index = m_Data.Insert(value);
 		if (index != -1) {
-			CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Insert, index, new Param1<TValue>(value)));
+			NotifyValueChanged(NotifyCollectionChangedAction.Insert, index, value);
 		}
 
 		return index;
@@ -25,15 +26,27 @@ class ObservableCollectionNonRef<Class TValue> : Observable
 	int InsertAt(TValue value, int index)
 	{
 		int new_index = m_Data.InsertAt(value, index);
-		CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.InsertAt, index, new Param1<TValue>(value)));
+		NotifyValueChanged(NotifyCollectionChangedAction.InsertAt, index, value);
 		return new_index;
 	}
 	
+	// one InsertRange notification for all of them
 	void InsertAll(notnull array<TValue> from)
 	{
+		InsertRange(from, m_Data.Count());
+	}
+
+	void InsertRange(notnull array<TValue> from, int index)
+	{
+		if (from.Count() == 0) {
+			return;
+		}
+
 		for (int i = 0; i < from.Count(); i++) {
-			Insert(from[i]);
+			m_Data.InsertAt(from[i], index + i);
 		}
+
+		CollectionChanged(NotifyCollectionChangedAction.InsertRange, -1, new CollectionRangeArgs(index, from.Count()));
 	}
 	
 	// 0: TValue value
@@ -50,21 +63,26 @@ class ObservableCollectionNonRef<Class TValue> : Observable
 
 	void Remove(int index)
 	{
-		CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Remove, index, new Param1<TValue>(m_Data.Get(index))));
+		NotifyValueChanged(NotifyCollectionChangedAction.Remove, index, m_Data.Get(index));
 		m_Data.Remove(index);
 	}
 	
 	void RemoveOrdered(int index)
 	{	// not sure if anything other than the Editor Log Entries removal needs this. but it works
-		CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Remove, index, new Param1<TValue>(m_Data.Get(index))));
+		NotifyValueChanged(NotifyCollectionChangedAction.Remove, index, m_Data.Get(index));
 		m_Data.RemoveOrdered(index);
 	}
 
+	// removes start to end (exclusive) with one RemoveRange notification, sent while the items are still there
 	void RemoveRange(int start, int end)
 	{
-		for (int i = start; i < end; i++)
-		{
-			CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Remove, start, new Param1<TValue>(m_Data.Get(start))));
+		end = Math.Min(end, m_Data.Count());
+		if (start >= end) {
+			return;
+		}
+
+		CollectionChanged(NotifyCollectionChangedAction.RemoveRange, -1, new CollectionRangeArgs(start, end - start));
+		for (int i = start; i < end; i++) {
 			m_Data.RemoveOrdered(start);
 		}
 	}
@@ -79,7 +97,7 @@ class ObservableCollectionNonRef<Class TValue> : Observable
 
 	void Set(int index, TValue value)
 	{
-		CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Replace, index, new Param1<TValue>(value)));
+		NotifyValueChanged(NotifyCollectionChangedAction.Replace, index, value);
 		m_Data.Set(index, value);
 	}
 
@@ -87,20 +105,33 @@ class ObservableCollectionNonRef<Class TValue> : Observable
 	{
 		TValue value = m_Data.Get(index);
 		int new_index = m_Data.MoveIndex(index, moveIndex);
-		CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Move, new_index, new Param1<TValue>(value)));
+		NotifyValueChanged(NotifyCollectionChangedAction.Move, new_index, value);
 		return new_index;
 	}
 
 	void SwapItems(int itemA, int itemB)
 	{
 		m_Data.SwapItems(itemA, itemB);
-		CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Swap, -1, new CollectionSwapArgs(itemA, itemB)));
+		CollectionChanged(NotifyCollectionChangedAction.Swap, -1, new CollectionSwapArgs(itemA, itemB));
 	}
 
 	void Clear()
 	{
 		m_Data.Clear();
-		CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Clear, -1, null));
+		CollectionChanged(NotifyCollectionChangedAction.Clear, -1, null);
+	}
+
+	// replaces the whole collection, views rebuild once instead of per item
+	void Reset(notnull array<TValue> from)
+	{
+		// filled before m_Data lets go, from may hold items m_Data owns
+		array<TValue> data = {};
+		for (int i = 0; i < from.Count(); i++) {
+			data.Insert(from[i]);
+		}
+
+		m_Data = data;
+		CollectionChanged(NotifyCollectionChangedAction.Reset, -1, null);
 	}
 
 	TValue Get(int index)
@@ -122,4 +153,21 @@ class ObservableCollectionNonRef<Class TValue> : Observable
 	{
 		return m_Data.Find(value);
 	}
+
+	override void ConvertItem(int index, TypeConverter type_converter)
+	{
+		Param1<TValue> value = m_ChangedValuePool.Acquire();
+		value.param1 = m_Data[index];
+		type_converter.SetParam(value);
+		m_ChangedValuePool.Release(value);
+	}
+
+	// the value param is reused, it is only valid while CollectionChanged runs
+	protected void NotifyValueChanged(NotifyCollectionChangedAction changed_action, int changed_index, TValue value)
+	{
+		Param1<TValue> changed_value = m_ChangedValuePool.Acquire();
+		changed_value.param1 = value;
+		CollectionChanged(changed_action, changed_index, changed_value);
+		m_ChangedValuePool.Release(changed_value);
+	}
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 class ObservableDictionary<Class TKey, Class TValue>: Observable
 {
 	protected ref map<TKey, ref TValue> m_Data = new map<TKey, ref TValue>();
+	protected ref Param1Pool<TValue> m_ChangedValuePool = new Param1Pool<TValue>();
 
 	void ObservableDictionary(ViewController controller)
 	{
@@ -21,28 +22,28 @@ class ObservableDictionary<Class TKey, Class TValue>: Observable
 			return false;
 		}
 		
-		CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Insert, m_Data.GetValueArray().Find(value), new Param1<TValue>(value)));		
+		NotifyValueChanged(NotifyCollectionChangedAction.Insert, m_Data.GetValueArray().Find(value), value);		
 		return true;
 	}
 
 	void Remove(TKey key)
 	{
 		if (m_Data.Contains(key)) {
-			CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Remove, m_Data.GetKeyArray().Find(key), new Param1<TValue>(m_Data[key])));
+			NotifyValueChanged(NotifyCollectionChangedAction.Remove, m_Data.GetKeyArray().Find(key), m_Data[key]);
 			m_Data.Remove(key);
 		}
 	}
 
 	void Remove(int index)
 	{
-		CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Remove, index, new Param1<TValue>(m_Data.GetElement(index))));
+		NotifyValueChanged(NotifyCollectionChangedAction.Remove, index, m_Data.GetElement(index));
 		m_Data.RemoveElement(index);
 	}
 
 	void RemoveRange(int start, int end)
 	{
 		for (int i = start; i < end; i++) {
-			CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Remove, i, new Param1<TValue>(m_Data.GetElement(i))));
+			NotifyValueChanged(NotifyCollectionChangedAction.Remove, i, m_Data.GetElement(i));
 			m_Data.RemoveElement(i);
 		}
 	}
@@ -50,7 +51,7 @@ class ObservableDictionary<Class TKey, Class TValue>: Observable
 	void Clear()
 	{
 		m_Data.Clear();
-		CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Clear, -1, null));
+		CollectionChanged(NotifyCollectionChangedAction.Clear, -1, null);
 	}
 
 	void Set(TKey key, TValue value)
@@ -62,7 +63,7 @@ class ObservableDictionary<Class TKey, Class TValue>: Observable
 			action = NotifyCollectionChangedAction.InsertAt;
 		}
 		
-		CollectionChanged(new CollectionChangedEventArgs(this, action, m_Data.GetValueArray().Find(value), new Param1<TValue>(value)));
+		NotifyValueChanged(action, m_Data.GetValueArray().Find(value), value);
 	}
 
 	TValue Get(TKey key)
@@ -89,4 +90,13 @@ class ObservableDictionary<Class TKey, Class TValue>: Observable
 	{
 		return m_Data.Count();
 	}
+
+	// the value param is reused, it is only valid while CollectionChanged runs
+	protected void NotifyValueChanged(NotifyCollectionChangedAction changed_action, int changed_index, TValue value)
+	{
+		Param1<TValue> changed_value = m_ChangedValuePool.Acquire();
+		changed_value.param1 = value;
+		CollectionChanged(changed_action, changed_index, changed_value);
+		m_ChangedValuePool.Release(changed_value);
+	}
 }
\ No newline at end of file
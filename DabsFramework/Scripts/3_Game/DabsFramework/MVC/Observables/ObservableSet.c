@@ -1,6 +1,7 @@
 class ObservableSet<Class TValue> : Observable
 {
 	private	ref set<TValue> _data = new set<TValue>();
+	protected ref Param1Pool<TValue> m_ChangedValuePool = new Param1Pool<TValue>();
 	
 	void ~ObservableSet()
 	{
@@ -11,7 +12,7 @@ class ObservableSet<Class TValue> : Observable
 	{
 		int index = _data.Insert(value);
 		if (index != -1) {
-			CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Add, index, new Param1<TValue>(value)));
+			NotifyValueChanged(NotifyCollectionChangedAction.Add, index, value);
 		}
 
 		return index;
@@ -20,13 +21,13 @@ class ObservableSet<Class TValue> : Observable
 	int InsertAt(TValue value, int index)
 	{
 		int new_index = _data.InsertAt(value, index);
-		CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Set, index, new Param1<TValue>(value)));
+		NotifyValueChanged(NotifyCollectionChangedAction.Set, index, value);
 		return new_index;
 	}
 
 	void Remove(int index)
 	{
-		CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Remove, index, new Param1<TValue>(_data.Get(index))));
+		NotifyValueChanged(NotifyCollectionChangedAction.Remove, index, _data.Get(index));
 		_data.Remove(index);
 	}
 
@@ -40,21 +41,21 @@ class ObservableSet<Class TValue> : Observable
 
 	void Set(int index, TValue value)
 	{
-		CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Set, index, new Param1<TValue>(value)));
+		NotifyValueChanged(NotifyCollectionChangedAction.Set, index, value);
 		_data.Set(index, value);
 	}
 
 	int Move(int index, int moveindex)
 	{
 		int new_index = _data.MoveIndex(index, moveindex);
-		CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Move, index, new Param1<int>(new_index)));
+		CollectionChanged(NotifyCollectionChangedAction.Move, index, new Param1<int>(new_index));
 		return new_index;
 	}
 
 	void Clear()
 	{
 		_data.Clear();
-		CollectionChanged(new CollectionChangedEventArgs(this, NotifyCollectionChangedAction.Clear, -1, null));
+		CollectionChanged(NotifyCollectionChangedAction.Clear, -1, null);
 	}
 
 	TValue Get(int index)
@@ -76,4 +77,13 @@ class ObservableSet<Class TValue> : Observable
 	{
 		return TValue;
 	}
+
+	// the value param is reused, it is only valid while CollectionChanged runs
+	protected void NotifyValueChanged(NotifyCollectionChangedAction changed_action, int changed_index, TValue value)
+	{
+		Param1<TValue> changed_value = m_ChangedValuePool.Acquire();
+		changed_value.param1 = value;
+		CollectionChanged(changed_action, changed_index, changed_value);
+		m_ChangedValuePool.Release(changed_value);
+	}
 }
\ No newline at end of file
@@ -197,7 +197,7 @@ class ScriptView: ScriptedViewBase
 #endif
 #endif
 		
-		LoadWidgetsAsVariables(this, new PropertyTypeHashMap(Type()), m_LayoutRoot);
+		LoadWidgetsAsVariables(this, PropertyTypeCache.Get(Type()), m_LayoutRoot);
 
 #ifndef WORKBENCH
 #ifndef NO_GUI
@@ -218,7 +218,7 @@ class ScriptView: ScriptedViewBase
 			}
 
 			// Since its not loaded in the WB, needs to be called here
-			LoadWidgetsAsVariables(m_Controller, new PropertyTypeHashMap(GetControllerType()), m_LayoutRoot);
+			LoadWidgetsAsVariables(m_Controller, PropertyTypeCache.Get(GetControllerType()), m_LayoutRoot);
 			
 			// ViewController controls the hierarchy events
 			m_Controller.OnWidgetScriptInit(m_LayoutRoot);
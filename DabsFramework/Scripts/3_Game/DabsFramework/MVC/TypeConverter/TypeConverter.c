@@ -38,6 +38,29 @@ class TypeConverter
 	void SetToController(Class context, string name, int index);
 	void GetFromController(Class context, string name, int index);
 
+	// same as above with a compiled path, nothing happens when something along the path is null
+	bool SetToBinding(Class context, BindingPath path, int index)
+	{
+		context = path.Resolve(context);
+		if (!context) {
+			return false;
+		}
+
+		SetToController(context, path.GetName(), index);
+		return true;
+	}
+
+	bool GetFromBinding(Class context, BindingPath path, int index)
+	{
+		context = path.Resolve(context);
+		if (!context) {
+			return false;
+		}
+
+		GetFromController(context, path.GetName(), index);
+		return true;
+	}
+
 	ScriptCaller GetterFromType(typename type)
 	{
 		switch (type) {
@@ -138,4 +161,26 @@ class TypeConversionTemplate<Class T>: TypeConverter
 		PropertyInfo property_info = PropertyInfo.GetSubScope(context, name);
 		EnScript.GetClassVar(context, property_info.Name, index, m_Value);
 	}
+
+	override bool SetToBinding(Class context, BindingPath path, int index)
+	{
+		context = path.Resolve(context);
+		if (!context) {
+			return false;
+		}
+
+		EnScript.SetClassVar(context, path.GetName(), index, m_Value);
+		return true;
+	}
+
+	override bool GetFromBinding(Class context, BindingPath path, int index)
+	{
+		context = path.Resolve(context);
+		if (!context) {
+			return false;
+		}
+
+		EnScript.GetClassVar(context, path.GetName(), index, m_Value);
+		return true;
+	}
 }
\ No newline at end of file
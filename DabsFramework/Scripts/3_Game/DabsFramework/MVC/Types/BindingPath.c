@@ -0,0 +1,91 @@
+// A Binding_Name (Ex: m_Data.Stats.Kills) split and resolved once, so reading / writing it later doesnt touch strings
+// this is the compiled version of PropertyInfo.GetSubScope
+class BindingPath: Managed
+{
+	protected string m_Path;
+
+	// every segment but the last, walked with GetClassVar
+	protected ref array<string> m_Scopes = {};
+
+	// type of each scope, then the final property
+	protected ref array<typename> m_Types = {};
+
+	// final segment, the variable that actually gets read / written
+	protected string m_Name;
+
+	// context: resolves the types against it, scopes that are still null fall back to their declared type
+	void BindingPath(string path, Class context = null)
+	{
+		m_Path = path;
+
+		path.Split(".", m_Scopes);
+		if (m_Scopes.Count() == 0) {
+			return;
+		}
+
+		m_Name = m_Scopes[m_Scopes.Count() - 1];
+		m_Scopes.Remove(m_Scopes.Count() - 1);
+
+		if (!context) {
+			return;
+		}
+
+		typename type = context.Type();
+		foreach (string scope: m_Scopes) {
+			type = PropertyTypeCache.Get(type)[scope];
+			if (context) {
+				EnScript.GetClassVar(context, scope, 0, context);
+			}
+
+			if (context) {
+				type = context.Type();
+			}
+
+			m_Types.Insert(type);
+			if (!type) {
+				return;
+			}
+		}
+
+		m_Types.Insert(PropertyTypeCache.Get(type)[m_Name]);
+	}
+
+	// returns the object holding the final property, null when anything on the way is null
+	Class Resolve(Class context)
+	{
+		for (int i = 0; i < m_Scopes.Count(); i++) {
+			if (!context) {
+				return null;
+			}
+
+			EnScript.GetClassVar(context, m_Scopes[i], 0, context);
+		}
+
+		return context;
+	}
+
+	string GetPath()
+	{
+		return m_Path;
+	}
+
+	string GetName()
+	{
+		return m_Name;
+	}
+
+	// type of the final property when compiled, EMPTY_TYPENAME if it couldnt be resolved
+	typename GetType()
+	{
+		if (m_Types.Count() != m_Scopes.Count() + 1) {
+			return EMPTY_TYPENAME;
+		}
+
+		return m_Types[m_Types.Count() - 1];
+	}
+
+	int GetDepth()
+	{
+		return m_Scopes.Count();
+	}
+}
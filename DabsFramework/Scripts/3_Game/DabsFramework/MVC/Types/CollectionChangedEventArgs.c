@@ -1,5 +1,8 @@
+// pooled, only valid while the change is being notified (see ViewController::CollectionChanged)
 class CollectionChangedEventArgs: Managed
 {
+	protected static ref CollectionChangedEventArgsPool m_Pool = new CollectionChangedEventArgsPool();
+	
 	// Event Args for Collection ChangedIndex
 	// 0: Collection that was changed
 	Observable Source;
@@ -13,11 +16,36 @@ class CollectionChangedEventArgs: Managed
 	// 3: Value of change
 	Param ChangedValue;
 	
-	void CollectionChangedEventArgs(Observable source, NotifyCollectionChangedAction changed_action, int changed_index, Param changed_value)
+	void CollectionChangedEventArgs(Observable source = null, NotifyCollectionChangedAction changed_action = 0, int changed_index = -1, Param changed_value = null)
 	{
 		Source = source;
 		ChangedAction = changed_action;
 		ChangedIndex = changed_index;
 		ChangedValue = changed_value;
 	}
+	
+	// pooled args, used by Observable for every change
+	static CollectionChangedEventArgs Acquire(Observable source, NotifyCollectionChangedAction changed_action, int changed_index, Param changed_value)
+	{
+		CollectionChangedEventArgs args = m_Pool.Acquire();
+		args.Source = source;
+		args.ChangedAction = changed_action;
+		args.ChangedIndex = changed_index;
+		args.ChangedValue = changed_value;
+		return args;
+	}
+	
+	static void Release(CollectionChangedEventArgs args)
+	{
+		m_Pool.Release(args);
+	}
+}
+
+class CollectionChangedEventArgsPool: ObjectPool<CollectionChangedEventArgs>
+{
+	override protected void OnRelease(CollectionChangedEventArgs item)
+	{
+		item.Source = null;
+		item.ChangedValue = null;
+	}
 }
\ No newline at end of file
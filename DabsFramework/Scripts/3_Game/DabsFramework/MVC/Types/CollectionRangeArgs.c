@@ -0,0 +1,3 @@
+// 0: index of the first item
+// 1: item count
+typedef Param2<int, int> CollectionRangeArgs;
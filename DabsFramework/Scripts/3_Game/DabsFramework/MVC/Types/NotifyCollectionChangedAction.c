@@ -6,5 +6,8 @@ enum NotifyCollectionChangedAction
 	Replace,
 	Move,
 	Swap,
-	Clear
+	Clear,
+	InsertRange,
+	RemoveRange,
+	Reset
 };
\ No newline at end of file
@@ -0,0 +1,22 @@
+// Process wide PropertyTypeHashMap per type, so reflection only walks each type once
+class PropertyTypeCache
+{
+	protected static ref map<typename, ref PropertyTypeHashMap> m_HashMaps = new map<typename, ref PropertyTypeHashMap>();
+	
+	// shared between every caller, dont modify it. construct a PropertyTypeHashMap when you need your own
+	static PropertyTypeHashMap Get(typename type)
+	{
+		PropertyTypeHashMap hash_map = m_HashMaps[type];
+		if (!hash_map) {
+			hash_map = new PropertyTypeHashMap(type);
+			m_HashMaps.Insert(type, hash_map);
+		}
+		
+		return hash_map;
+	}
+	
+	static void Clear()
+	{
+		m_HashMaps.Clear();
+	}
+}
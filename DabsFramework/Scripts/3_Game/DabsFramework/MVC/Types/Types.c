@@ -11,7 +11,7 @@ class PropertyTypeHashMap: map<string, typename>
 	
 	void RemoveType(typename removed_type)
 	{
-		PropertyTypeHashMap hash_map = new PropertyTypeHashMap(removed_type);
+		PropertyTypeHashMap hash_map = PropertyTypeCache.Get(removed_type);
 		foreach (string name, typename type: hash_map) {
 			Remove(name);
 		}
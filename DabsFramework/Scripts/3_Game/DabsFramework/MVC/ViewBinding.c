@@ -37,6 +37,42 @@ class ViewBinding : ScriptedViewBase
 		return m_SelectedConverter;
 	}
 
+	// Binding_Name and Selected_Item compiled once, so updates dont have to split them every time
+	protected ref BindingPath m_BindingPath;
+	protected ref BindingPath m_SelectedPath;
+
+	void CompileBindingPaths(ViewController controller)
+	{
+		m_BindingPath = null;
+		if (Binding_Name != string.Empty) {
+			m_BindingPath = new BindingPath(Binding_Name, controller);
+		}
+
+		m_SelectedPath = null;
+		if (Selected_Item != string.Empty) {
+			m_SelectedPath = new BindingPath(Selected_Item, controller);
+		}
+	}
+
+	// resolved type of Binding_Name, EMPTY_TYPENAME when it couldnt be resolved
+	typename GetBindingType()
+	{
+		if (!m_BindingPath) {
+			return EMPTY_TYPENAME;
+		}
+
+		return m_BindingPath.GetType();
+	}
+
+	typename GetSelectedType()
+	{
+		if (!m_SelectedPath) {
+			return EMPTY_TYPENAME;
+		}
+
+		return m_SelectedPath.GetType();
+	}
+
 	override void OnWidgetScriptInit(Widget w)
 	{
 		super.OnWidgetScriptInit(w);
@@ -85,8 +121,12 @@ class ViewBinding : ScriptedViewBase
 				Log("Updating %1 to the value of %2", m_LayoutRoot.GetName(), Binding_Name);
 			}
 			
-			m_PropertyConverter.GetFromController(controller, Binding_Name, 0);
-			m_WidgetController.Set(m_PropertyConverter);
+			if (!m_BindingPath) {
+				m_PropertyConverter.GetFromController(controller, Binding_Name, 0);
+				m_WidgetController.Set(m_PropertyConverter);
+			} else if (m_PropertyConverter.GetFromBinding(controller, m_BindingPath, 0)) {
+				m_WidgetController.Set(m_PropertyConverter);
+			}
 		}
 
 		// Selected_Item handler
@@ -95,8 +135,12 @@ class ViewBinding : ScriptedViewBase
 				Log("Updating %1 to the value of %2", m_LayoutRoot.GetName(), Selected_Item);
 			}
 			
-			m_SelectedConverter.GetFromController(controller, Selected_Item, 0);
-			m_WidgetController.SetSelection(m_SelectedConverter);
+			if (!m_SelectedPath) {
+				m_SelectedConverter.GetFromController(controller, Selected_Item, 0);
+				m_WidgetController.SetSelection(m_SelectedConverter);
+			} else if (m_SelectedConverter.GetFromBinding(controller, m_SelectedPath, 0)) {
+				m_WidgetController.SetSelection(m_SelectedConverter);
+			}
 		}
 	}
 
@@ -112,7 +156,12 @@ class ViewBinding : ScriptedViewBase
 		if (m_PropertyConverter && Two_Way_Binding && m_WidgetController.CanTwoWayBind()) {
 			Log("Setting %1 to the value of %2", Binding_Name, m_LayoutRoot.GetName());
 			m_WidgetController.Get(m_PropertyConverter);
-			m_PropertyConverter.SetToController(controller, Binding_Name, 0);
+			if (m_BindingPath) {
+				m_PropertyConverter.SetToBinding(controller, m_BindingPath, 0);
+			} else {
+				m_PropertyConverter.SetToController(controller, Binding_Name, 0);
+			}
+
 			controller.NotifyPropertyChanged(Binding_Name);
 		}
 
@@ -120,7 +169,12 @@ class ViewBinding : ScriptedViewBase
 		if (m_SelectedConverter) {
 			Log("Setting Selection of %1 with value of %2", Selected_Item, m_LayoutRoot.GetName());
 			m_WidgetController.GetSelection(m_SelectedConverter);
-			m_SelectedConverter.SetToController(controller, Selected_Item, 0);
+			if (m_SelectedPath) {
+				m_SelectedConverter.SetToBinding(controller, m_SelectedPath, 0);
+			} else {
+				m_SelectedConverter.SetToController(controller, Selected_Item, 0);
+			}
+
 			controller.NotifyPropertyChanged(Selected_Item);
 		}
 	}
@@ -185,6 +239,23 @@ class ViewBinding : ScriptedViewBase
 				break;
 			}
 
+			case NotifyCollectionChangedAction.InsertRange: {
+				CollectionRangeArgs insert_args = CollectionRangeArgs.Cast(args.ChangedValue);
+				m_WidgetController.InsertRange(insert_args.param1, insert_args.param2, args.Source, collectionConverter);
+				break;
+			}
+
+			case NotifyCollectionChangedAction.RemoveRange: {
+				CollectionRangeArgs remove_args = CollectionRangeArgs.Cast(args.ChangedValue);
+				m_WidgetController.RemoveRange(remove_args.param1, remove_args.param2, args.Source, collectionConverter);
+				break;
+			}
+
+			case NotifyCollectionChangedAction.Reset: {
+				m_WidgetController.Reset(args.Source, collectionConverter);
+				break;
+			}
+
 			default: {
 				Error("Invalid NotifyCollectionChangedAction Type %1", args.ChangedAction.ToString());
 			}
@@ -48,12 +48,43 @@ class ViewController: ScriptedViewBase
 	[NonSerialized()]
 	protected ref DataBindingHashMap m_DataBindingHashMap = new DataBindingHashMap();
 	
-	// Hashmap of all properties in the Controller
+	// Hashmap of all properties in the Controller, shared with every controller of this type (see PropertyTypeCache)
 	[NonSerialized()]
-	protected ref PropertyTypeHashMap m_PropertyTypeHashMap = new PropertyTypeHashMap(Type());
+	protected ref PropertyTypeHashMap m_PropertyTypeHashMap = PropertyTypeCache.Get(Type());
 
 	[NonSerialized()]
 	protected ref ScriptedViewBaseHandler m_ScriptedViewBaseHandler = new ScriptedViewBaseHandler(this);
+	
+	// Deferred notify, see SetDeferredNotify
+	[NonSerialized()]
+	protected bool m_DeferredNotify;
+	
+	// 0: Property Name
+	// 1: Notify Controller
+	[NonSerialized()]
+	protected ref map<string, bool> m_DirtyProperties = new map<string, bool>();
+	
+	// swapped with m_DirtyProperties while flushing, so properties changed by PropertyChanged land in the next flush
+	[NonSerialized()]
+	protected ref map<string, bool> m_FlushingProperties = new map<string, bool>();
+	
+	[NonSerialized()]
+	protected bool m_DirtyAllProperties, m_DirtyAllNotifyController;
+	
+	[NonSerialized()]
+	protected bool m_FlushQueued, m_Flushing;
+
+	// Observable -> name of the property holding it, so collection changes dont have to scan every variable
+	// checked against the property on lookup, reassigned fields get re-indexed by NotifyPropertyChanged or the next miss
+	[NonSerialized()]
+	protected ref map<Observable, string> m_ObservableNames = new map<Observable, string>();
+
+	void ~ViewController()
+	{
+		if (m_FlushQueued && GetGame()) {
+			GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(FlushBindings);
+		}
+	}
 
 	override void OnWidgetScriptInit(Widget w)
 	{
@@ -88,6 +119,112 @@ class ViewController: ScriptedViewBase
 		// the whole damn thing breaks. Thanks 
 		Trace("NotifyPropertyChanged %1", property_name);
 
+		if (m_DeferredNotify) {
+			MarkPropertyDirty(property_name, notify_controller);
+			return;
+		}
+
+		UpdateProperty(property_name, notify_controller);
+	}
+	
+	/*
+	* Deferred notify: NotifyPropertyChanged only marks the property as dirty,
+	* every dirty property is then pushed to its bindings once on the next GUI frame.
+	* Handy for controllers that change the same property several times a frame.
+	*
+	* Off by default. Turning it off flushes whatever is still dirty
+	*/
+	
+	void SetDeferredNotify(bool state)
+	{
+		m_DeferredNotify = state;
+		if (!m_DeferredNotify) {
+			FlushBindings();
+		}
+	}
+	
+	bool IsDeferredNotify()
+	{
+		return m_DeferredNotify;
+	}
+	
+	// Pushes every dirty property right away, for callers that need the view to be up to date now
+	void FlushBindings()
+	{
+		if (m_FlushQueued) {
+			m_FlushQueued = false;
+			GetGame().GetCallQueue(CALL_CATEGORY_GUI).Remove(FlushBindings);
+		}
+		
+		// anything changed from inside PropertyChanged waits for the next frame
+		if (m_Flushing) {
+			return;
+		}
+		
+		m_Flushing = true;
+		
+		map<string, bool> dirty_properties = m_DirtyProperties;
+		m_DirtyProperties = m_FlushingProperties;
+		m_FlushingProperties = dirty_properties;
+		
+		bool updated_all = m_DirtyAllProperties;
+		bool notified_all = m_DirtyAllNotifyController;
+		m_DirtyAllProperties = false;
+		m_DirtyAllNotifyController = false;
+		if (updated_all) {
+			UpdateProperty(string.Empty, notified_all);
+		}
+		
+		foreach (string property_name, bool notify_controller: m_FlushingProperties) {
+			// views are already up to date, the controller might still be owed its PropertyChanged
+			if (updated_all) {
+				if (notify_controller && !notified_all) {
+					PropertyChanged(property_name);
+				}
+				
+				continue;
+			}
+			
+			UpdateProperty(property_name, notify_controller);
+		}
+		
+		m_FlushingProperties.Clear();
+		m_Flushing = false;
+		
+		if (m_DirtyAllProperties || m_DirtyProperties.Count() > 0) {
+			QueueFlush();
+		}
+	}
+	
+	protected void MarkPropertyDirty(string property_name, bool notify_controller)
+	{
+		// the controller is notified once if any of the changes asked for it
+		if (property_name == string.Empty) {
+			m_DirtyAllProperties = true;
+			m_DirtyAllNotifyController = m_DirtyAllNotifyController || notify_controller;
+		} else {
+			m_DirtyProperties[property_name] = m_DirtyProperties[property_name] || notify_controller;
+		}
+		
+		if (!m_Flushing) {
+			QueueFlush();
+		}
+	}
+	
+	protected void QueueFlush()
+	{
+		if (m_FlushQueued || !GetGame()) {
+			return;
+		}
+		
+		m_FlushQueued = true;
+		GetGame().GetCallQueue(CALL_CATEGORY_GUI).Call(FlushBindings);
+	}
+	
+	// Pushes property_name to its bindings right away, empty updates every property
+	protected void UpdateProperty(string property_name, bool notify_controller)
+	{
+		IndexObservable(property_name);
 		if (property_name == string.Empty) {
 			Log("Updating all properties in View, this is NOT recommended as it is performance intensive");
 			foreach (ViewBindingSet view_array: m_DataBindingHashMap) {
@@ -135,7 +272,7 @@ class ViewController: ScriptedViewBase
 	{
 		Trace("NotifyCollectionChanged %1", args.Source.ToString());
 
-		string collection_name = GetVariableName(args.Source);
+		string collection_name = FindObservableName(args.Source);
 		if (collection_name == string.Empty) {
 			Error("NotifyCollectionChanged could not find variable %1 in %2", args.Source.ToString(), string.ToString(this));
 			return;
@@ -160,6 +297,8 @@ class ViewController: ScriptedViewBase
 
 	// Gets called every time an observable collection is changed.
 	// Override this when you want to have an event AFTER collection is changed
+	// args and args.ChangedValue are pooled and reused once this returns, dont store them or pass them to CallLater
+	// copy out whatever you need (args.Source, args.ChangedIndex, the value inside ChangedValue) instead
 	void CollectionChanged(string collection_name, CollectionChangedEventArgs args)
 	{
 	}
@@ -176,7 +315,9 @@ class ViewController: ScriptedViewBase
 			m_ViewBindingHashMap.Insert(w, view_binding);
 			m_DataBindingHashMap.InsertView(view_binding);
 
-			view_binding.SetProperties(GetControllerProperty(view_binding.Binding_Name), GetControllerProperty(view_binding.Selected_Item));
+			// types come from the compiled paths, no need to walk Binding_Name again
+			view_binding.CompileBindingPaths(this);
+			view_binding.SetProperties(view_binding.GetBindingType(), view_binding.GetSelectedType());
 
 			// todo find a way to define these on ScriptView aswell
 			// Load RelayCommand
@@ -194,9 +335,9 @@ class ViewController: ScriptedViewBase
 				}
 			}
 
-			// Load property for the first time
+			// Load property for the first time, deferred or not
 			if (view_binding.Binding_Name != string.Empty) {
-				NotifyPropertyChanged(view_binding.Binding_Name, false);
+				UpdateProperty(view_binding.Binding_Name, false);
 			}
 		}
 
@@ -248,6 +389,55 @@ class ViewController: ScriptedViewBase
 		return EMPTY_TYPENAME;
 	}
 
+	// cached version of GetVariableName for Observables
+	protected string FindObservableName(Observable observable)
+	{
+		string name;
+		if (m_ObservableNames.Find(observable, name)) {
+			Observable current;
+			EnScript.GetClassVar(this, name, 0, current);
+			if (current == observable) {
+				return name;
+			}
+
+			// field was reassigned without a NotifyPropertyChanged
+			m_ObservableNames.Remove(observable);
+		}
+
+		name = GetVariableName(observable);
+		if (name != string.Empty) {
+			m_ObservableNames.Insert(observable, name);
+		}
+
+		return name;
+	}
+
+	// re-reads property_name into m_ObservableNames when it holds an Observable, empty property_name does all of them
+	protected void IndexObservable(string property_name)
+	{
+		if (property_name == string.Empty) {
+			m_ObservableNames.Clear();
+			foreach (string name, typename type: m_PropertyTypeHashMap) {
+				if (type.IsInherited(Observable)) {
+					IndexObservable(name);
+				}
+			}
+
+			return;
+		}
+
+		typename property_type = m_PropertyTypeHashMap[property_name];
+		if (!property_type || !property_type.IsInherited(Observable)) {
+			return;
+		}
+
+		Observable observable;
+		EnScript.GetClassVar(this, property_name, 0, observable);
+		if (observable) {
+			m_ObservableNames.Set(observable, property_name);
+		}
+	}
+
 	protected string GetVariableName(Class target_variable)
 	{
 		typename type = Type();
@@ -38,6 +38,30 @@ class SpacerBaseWidgetController : WidgetControllerTemplate<SpacerBaseWidget>
 		}
 	}
 
+	// finds the insert position once instead of once per item
+	override void InsertRange(int index, int count, Observable source, TypeConverter type_converter)
+	{
+		Widget widget_a;
+		if (index + count != source.Count()) {
+			widget_a = GetChildAtIndex(m_Widget, index);
+		}
+
+		for (int i = 0; i < count; i++) {
+			source.ConvertItem(index + i, type_converter);
+			Widget widget_b = type_converter.GetWidget();
+			if (!widget_b) {
+				continue;
+			}
+
+			if (widget_a) {
+				m_Widget.AddChildAfter(widget_b, widget_a);
+				widget_a = widget_b;
+			} else {
+				m_Widget.AddChild(widget_b);
+			}
+		}
+	}
+
 	override void Replace(int index, TypeConverter type_converter)
 	{
 		if (type_converter.GetWidget()) {
@@ -89,8 +113,9 @@ class SpacerBaseWidgetController : WidgetControllerTemplate<SpacerBaseWidget>
 	{
 		Widget widget_a = m_Widget.GetChildren();
 		while (widget_a) {
+			Widget widget_b = widget_a.GetSibling();
 			m_Widget.RemoveChild(widget_a);
-			widget_a = widget_a.GetSibling();
+			widget_a = widget_b;
 		}
 	}
 
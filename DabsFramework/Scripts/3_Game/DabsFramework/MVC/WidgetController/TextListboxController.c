@@ -35,6 +35,19 @@ class TextListboxController : WidgetControllerTemplate<TextListboxWidget>
 		m_Widget.SetItem(index, type_converter.GetString(), type_converter, 0);
 	}
 
+	override void InsertRange(int index, int count, Observable source, TypeConverter type_converter)
+	{
+		if (index + count != source.Count()) {
+			super.InsertRange(index, count, source, type_converter);
+			return;
+		}
+
+		for (int i = 0; i < count; i++) {
+			source.ConvertItem(index + i, type_converter);
+			m_Widget.AddItem(type_converter.GetString(), type_converter, 0);
+		}
+	}
+
 	override void Remove(int index, TypeConverter type_converter)
 	{
 		m_Widget.SetItem(index, string.Empty, type_converter, 0);
@@ -56,6 +56,35 @@ class WidgetController
 		NotImplementedError("Clear");
 	}
 
+	// Range Stuff, source still holds the items while these run
+	// the defaults go item by item, override them when the widget can do better
+	void InsertRange(int index, int count, Observable source, TypeConverter type_converter)
+	{
+		bool append = (index + count == source.Count());
+		for (int i = 0; i < count; i++) {
+			source.ConvertItem(index + i, type_converter);
+			if (append) {
+				Insert(type_converter);
+			} else {
+				InsertAt(index + i, type_converter);
+			}
+		}
+	}
+
+	void RemoveRange(int index, int count, Observable source, TypeConverter type_converter)
+	{
+		for (int i = 0; i < count; i++) {
+			source.ConvertItem(index + i, type_converter);
+			Remove(index, type_converter);
+		}
+	}
+
+	void Reset(Observable source, TypeConverter type_converter)
+	{
+		Clear();
+		InsertRange(0, source.Count(), source, type_converter);
+	}
+
 	int Find(TypeConverter type_converter)
 	{
 		NotImplementedError("Find");
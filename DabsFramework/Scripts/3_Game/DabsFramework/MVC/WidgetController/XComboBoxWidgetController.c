@@ -25,6 +25,19 @@ class XComboBoxWidgetController : WidgetControllerTemplate<XComboBoxWidget>
 		m_Widget.SetItem(index, type_converter.GetString());
 	}
 
+	override void InsertRange(int index, int count, Observable source, TypeConverter type_converter)
+	{
+		if (index + count != source.Count()) {
+			super.InsertRange(index, count, source, type_converter);
+			return;
+		}
+
+		for (int i = 0; i < count; i++) {
+			source.ConvertItem(index + i, type_converter);
+			m_Widget.AddItem(type_converter.GetString());
+		}
+	}
+
 	override void Replace(int index, TypeConverter type_converter)
 	{
 		InsertAt(index, type_converter);
@@ -35,6 +48,14 @@ class XComboBoxWidgetController : WidgetControllerTemplate<XComboBoxWidget>
 		m_Widget.RemoveItem(index);
 	}
 
+	// items are removed by index, no need to convert them
+	override void RemoveRange(int index, int count, Observable source, TypeConverter type_converter)
+	{
+		for (int i = 0; i < count; i++) {
+			m_Widget.RemoveItem(index);
+		}
+	}
+
 	override void Clear()
 	{
 		m_Widget.ClearAll();
@@ -10,7 +10,7 @@ class ProfileSettings: Class
 	
 	void Load()
 	{
-		PropertyTypeHashMap properties = new PropertyTypeHashMap(Type());
+		PropertyTypeHashMap properties = PropertyTypeCache.Get(Type());
 		foreach (string variable_name, typename variable_type: properties) {
 			string variable_name_formatted = GetFormattedSaveName(variable_name);						
 			switch (variable_type) {
@@ -72,7 +72,7 @@ class ProfileSettings: Class
 		}
 				
 		// iterate though all properties of the class
-		PropertyTypeHashMap properties = new PropertyTypeHashMap(Type());
+		PropertyTypeHashMap properties = PropertyTypeCache.Get(Type());
 		foreach (string variable_name, typename variable_type: properties) {		
 			string variable_name_formatted = GetFormattedSaveName(variable_name);			
 			switch (variable_type) {
@@ -19,7 +19,7 @@ class OptionSelectorColorView: OptionSelectorViewBase
 		m_OptionSelectorColorViewController = OptionSelectorColorViewController.Cast(m_Controller);
 		m_OptionSelectorColorViewController.OnValueChanged = on_changed;
 		
-		PropertyTypeHashMap properties = new PropertyTypeHashMap(m_ProfileSettings.Type());		
+		PropertyTypeHashMap properties = PropertyTypeCache.Get(m_ProfileSettings.Type());		
 		TypeConverter type_converter = GetDayZGame().GetTypeConversion(properties[m_ProfileSettingsColor.GetVariableName()]);
 		if (!type_converter) {
 			Error(string.Format("Invalid variable type on registry type=%1", m_ProfileSettingsColor.GetVariableName()));
@@ -138,7 +138,7 @@ class OptionSelectorColorView: OptionSelectorViewBase
 		
 	override void Apply()
 	{
-		PropertyTypeHashMap properties = new PropertyTypeHashMap(m_ProfileSettings.Type());
+		PropertyTypeHashMap properties = PropertyTypeCache.Get(m_ProfileSettings.Type());
 		TypeConverter type_converter = GetDayZGame().GetTypeConversion(properties[m_ProfileSettingsColor.GetVariableName()]);
 		type_converter.SetInt(m_OptionSelectorColorViewController.Value);
 		type_converter.SetToController(m_ProfileSettings, m_ProfileSettingsColor.GetVariableName(), 0);
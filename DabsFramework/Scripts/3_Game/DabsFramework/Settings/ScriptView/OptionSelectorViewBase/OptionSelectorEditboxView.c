@@ -11,7 +11,7 @@ class OptionSelectorEditboxView: OptionSelectorViewBase
 		m_OptionSelectorEditboxViewController = OptionSelectorEditboxViewController.Cast(m_Controller);
 		m_OptionSelectorEditboxViewController.OnValueChanged = on_changed;
 		
-		PropertyTypeHashMap properties = new PropertyTypeHashMap(m_ProfileSettings.Type());
+		PropertyTypeHashMap properties = PropertyTypeCache.Get(m_ProfileSettings.Type());
 		TypeConverter type_converter = GetDayZGame().GetTypeConversion(properties[m_ProfileSettingText.GetVariableName()]);
 		if (!type_converter) {
 			Error(string.Format("Invalid variable type on registry type=%1", properties[m_ProfileSettingText.GetVariableName()]));
@@ -28,7 +28,7 @@ class OptionSelectorEditboxView: OptionSelectorViewBase
 	
 	override void Apply()
 	{
-		PropertyTypeHashMap properties = new PropertyTypeHashMap(m_ProfileSettings.Type());
+		PropertyTypeHashMap properties = PropertyTypeCache.Get(m_ProfileSettings.Type());
 		TypeConverter type_converter = GetDayZGame().GetTypeConversion(properties[m_ProfileSettingText.GetVariableName()]);
 		type_converter.SetString(m_OptionSelectorEditboxViewController.Value);
 		type_converter.SetToController(m_ProfileSettings, m_ProfileSettingText.GetVariableName(), 0);
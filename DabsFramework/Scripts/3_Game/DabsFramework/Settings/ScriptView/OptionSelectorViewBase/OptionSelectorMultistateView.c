@@ -7,7 +7,7 @@ class OptionSelectorMultistateView: OptionSelectorViewBase
 	{
 		m_ProfileSettingMultistate = profile_setting_multistate;
 		
-		PropertyTypeHashMap properties = new PropertyTypeHashMap(m_ProfileSettings.Type());
+		PropertyTypeHashMap properties = PropertyTypeCache.Get(m_ProfileSettings.Type());
 		TypeConverter type_converter = GetDayZGame().GetTypeConversion(properties[m_ProfileSettingMultistate.GetVariableName()]);
 		if (!type_converter) {
 			Error(string.Format("Invalid variable type on registry type=%1", properties[m_ProfileSettingMultistate.GetVariableName()]));
@@ -47,7 +47,7 @@ class OptionSelectorMultistateView: OptionSelectorViewBase
 	
 	override void Apply()
 	{
-		PropertyTypeHashMap properties = new PropertyTypeHashMap(m_ProfileSettings.Type());
+		PropertyTypeHashMap properties = PropertyTypeCache.Get(m_ProfileSettings.Type());
 		TypeConverter type_converter = GetDayZGame().GetTypeConversion(properties[m_ProfileSettingMultistate.GetVariableName()]);
 		if (!type_converter) {
 			Error("Failed to find type conversion for type " + m_ProfileSettingMultistate.GetVariableName());
@@ -61,7 +61,7 @@ class OptionSelectorMultistateView: OptionSelectorViewBase
 	
 	override void Revert()
 	{
-		PropertyTypeHashMap properties = new PropertyTypeHashMap(m_ProfileSettings.Type());
+		PropertyTypeHashMap properties = PropertyTypeCache.Get(m_ProfileSettings.Type());
 		TypeConverter type_converter = GetDayZGame().GetTypeConversion(properties[m_ProfileSettingMultistate.GetVariableName()]);
 		if (!type_converter) {
 			Error("Failed to find type conversion for type " + m_ProfileSettingMultistate.GetVariableName());
@@ -76,7 +76,7 @@ class OptionSelectorMultistateView: OptionSelectorViewBase
 	
 	override bool IsChanged()
 	{		
-		PropertyTypeHashMap properties = new PropertyTypeHashMap(m_ProfileSettings.Type());
+		PropertyTypeHashMap properties = PropertyTypeCache.Get(m_ProfileSettings.Type());
 		TypeConverter type_converter = GetDayZGame().GetTypeConversion(properties[m_ProfileSettingMultistate.GetVariableName()]);
 		if (!type_converter) {
 			Error("Failed to find type conversion for type " + m_ProfileSettingMultistate.GetVariableName());
@@ -224,7 +224,21 @@ class EditorObjectData: SerializableBase
 		return true;
 	}
 	
+	// class names to model names, finding one means spawning the object
+	protected static ref LRUCache<string, string> m_ModelNames = new LRUCache<string, string>(1024);
+	
 	static string GetModelName(string class_name)
+	{
+		string model_name;
+		if (!m_ModelNames.Find(class_name, model_name)) {
+			model_name = FindModelName(class_name);
+			m_ModelNames.Set(class_name, model_name);
+		}
+		
+		return model_name;
+	}
+	
+	protected static string FindModelName(string class_name)
 	{
 		Object object = GetGame().CreateObjectEx(class_name, vector.Zero, ECE_LOCAL | ECE_NONE);
 		if (object) {
@@ -12,6 +12,8 @@ modded class MissionServer
 	// Called immediately after main() is done, CLE is initialized by this point
 	void AfterHiveInit()
 	{
+		// only present in the Missions/Dev overlay
+		EventSimulation.RunFromFile();
 	}
 	
 	// load client info first hand
@@ -41,5 +43,10 @@ modded class MissionServer
 		if (m_JoinedPlayers.Find(identity.GetId()) != -1) {
 			m_JoinedPlayers.Remove(m_JoinedPlayers.Find(identity.GetId()));
 		}
+		
+		// the next connect needs a full event snapshot again
+		if (m_EventManager) {
+			m_EventManager.OnClientDisconnected(identity);
+		}
 	}
 }
\ No newline at end of file